@@ -0,0 +1,157 @@
+#ifndef HTTP_CHUNKED_DECODER_HPP
+#define HTTP_CHUNKED_DECODER_HPP
+
+#include <string>
+#include <span>
+#include <system_error>
+#include <cstdint>
+
+namespace tristan::network {
+
+    /**
+     * \class HttpChunkedDecoder
+     * \brief Resumable decoder of the chunked transfer coding (RFC 9112 section 7.1).
+     * Data may be fed in slices of any size, body data is returned as spans into the fed slices so it is never copied by the decoder.
+     * Chunk extensions are skipped, trailer fields are collected and may be retrieved once decoding is done.
+     * \Threadsafe No
+     */
+    class HttpChunkedDecoder {
+    public:
+        /**
+         * \brief Maximum size of the chunk size line including chunk extensions.
+         */
+        static constexpr uint64_t max_chunk_line_size = 4096;
+
+        /**
+         * \brief Maximum size of the trailer section.
+         */
+        static constexpr uint64_t max_trailers_size = 64 * 1024;
+
+        /**
+         * \enum State
+         * \brief Position of the decoder within the chunked body.
+         */
+        enum class State : uint8_t {
+            CHUNK_SIZE,
+            CHUNK_SIZE_DIGITS,
+            CHUNK_EXTENSION,
+            CHUNK_SIZE_LF,
+            CHUNK_DATA,
+            CHUNK_DATA_CR,
+            CHUNK_DATA_LF,
+            TRAILER,
+            TRAILER_LINE,
+            TRAILER_LF,
+            DONE,
+            FAILED
+        };
+
+        /**
+         * \struct Result
+         * \brief Result of the single consume call.
+         */
+        struct Result {
+            /**
+             * \brief Number of bytes of the fed slice which were consumed.
+             */
+            size_t m_consumed;
+
+            /**
+             * \brief Body data found in the fed slice. May be empty.
+             */
+            std::span< const uint8_t > m_body;
+        };
+
+        /**
+         * \brief Default constructor
+         */
+        HttpChunkedDecoder();
+        HttpChunkedDecoder(const HttpChunkedDecoder& p_other) = default;
+        HttpChunkedDecoder(HttpChunkedDecoder&& p_other) noexcept = default;
+
+        HttpChunkedDecoder& operator=(const HttpChunkedDecoder& p_other) = default;
+        HttpChunkedDecoder& operator=(HttpChunkedDecoder&& p_other) noexcept = default;
+
+        ~HttpChunkedDecoder() = default;
+
+        /**
+         * \brief Consumes framing from p_data up to and including the first run of body data.
+         * Should be called again with the rest of the slice until the whole slice is consumed or decoding is done.
+         * \param p_data std::span< const uint8_t >
+         * \return Result which body span points into p_data.
+         */
+        [[nodiscard]] auto consume(std::span< const uint8_t > p_data) -> Result;
+
+        /**
+         * \brief Decodes p_data in place. Body data is moved to the beginning of p_data.
+         * \param p_data std::span< uint8_t >
+         * \return size_t number of body bytes at the beginning of p_data.
+         */
+        [[nodiscard]] auto decode(std::span< uint8_t > p_data) -> size_t;
+
+        /**
+         * \brief Returns number of bytes which certainly belong to the chunked body and were not consumed yet.
+         * Reading not more than this number never reads bytes which follow the chunked body, e.g. next pipelined response.
+         * \return uint64_t, 0 if decoding is done or failed.
+         */
+        [[nodiscard]] auto bytesExpected() const noexcept -> uint64_t;
+
+        /**
+         * \brief Resets decoder to its initial state.
+         */
+        void reset();
+
+        /**
+         * \brief Returns current state.
+         * \return State
+         */
+        [[nodiscard]] auto state() const noexcept -> State;
+
+        /**
+         * \brief Returns true if last chunk and trailer section were consumed.
+         * \return bool
+         */
+        [[nodiscard]] auto done() const noexcept -> bool;
+
+        /**
+         * \brief Returns true if chunked body is malformed.
+         * \return bool
+         */
+        [[nodiscard]] auto failed() const noexcept -> bool;
+
+        /**
+         * \brief Returns decoding error.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+        /**
+         * \brief Returns trailer fields, each one terminated by CRLF.
+         * \return const std::string&
+         */
+        [[nodiscard]] auto trailers() const noexcept -> const std::string&;
+
+    protected:
+    private:
+        std::string m_trailers;
+
+        std::error_code m_error;
+
+        uint64_t m_chunk_size;
+
+        uint64_t m_bytes_remain;
+
+        uint64_t m_line_size;
+
+        State m_state;
+
+        [[nodiscard]] auto _consumeTrailerLine(std::span< const uint8_t > p_data, size_t p_position) -> size_t;
+
+        void _endChunkSizeLine();
+
+        void _fail();
+    };
+
+}  // namespace tristan::network
+
+#endif  //HTTP_CHUNKED_DECODER_HPP
@@ -1,10 +1,15 @@
 #ifndef HTTP_HEADER_HPP
 #define HTTP_HEADER_HPP
 
+#include "http_response_parser.hpp"
+#include "http_header_names.hpp"
+
 #include <string>
+#include <string_view>
 #include <vector>
 #include <filesystem>
 #include <optional>
+#include <cstdint>
 
 namespace tristan::network {
 
@@ -20,6 +25,8 @@ namespace tristan::network {
     /**
      * \class HttpHeaders
      * \brief Handles HTTP base. That is this class stores header names and values.
+     * Header names are matched case-insensitively by the hash which is computed once when header is added.
+     * Well-known header names are additionally tagged with http::HeaderId, so lookup by HeaderId does not touch the names.
      */
     class HttpHeaders {
     public:
@@ -37,6 +44,11 @@ namespace tristan::network {
          * \param p_headers_data const std::vector< uint8_t >&.
          */
         explicit HttpHeaders(std::vector< uint8_t >&& p_headers_data);
+        /**
+         * \brief Constructor
+         * \param p_parser const HttpResponseParser&. Parser which finished parsing the headers.
+         */
+        explicit HttpHeaders(const HttpResponseParser& p_parser);
         /**
          * \brief Copy constructor
          * \param p_other const HttpHeaders& other
@@ -67,20 +79,63 @@ namespace tristan::network {
          * \brief Return value for specified header.
          * \param p_header_name std::optional< std::string >
          * \return Header value if header is present, std::nullopt otherwise.
+         * \note Copies the value, value() should be preferred.
          */
         [[nodiscard]] auto headerValue(const std::string& p_header_name) const -> std::optional< std::string >;
 
+        /**
+         * \brief Returns value of the first header with specified name. Name is compared case-insensitively.
+         * \param p_header_name std::string_view
+         * \return std::optional< std::string_view > which is valid while headers are not modified.
+         */
+        [[nodiscard]] auto value(std::string_view p_header_name) const noexcept -> std::optional< std::string_view >;
+
+        /**
+         * \brief Returns values of all headers with specified name in order of arrival. Name is compared case-insensitively.
+         * \param p_header_name std::string_view
+         * \return std::vector< std::string_view > which are valid while headers are not modified.
+         */
+        [[nodiscard]] auto values(std::string_view p_header_name) const -> std::vector< std::string_view >;
+
+        /**
+         * \brief Returns true if header with specified name is present. Name is compared case-insensitively.
+         * \param p_header_name std::string_view
+         * \return bool
+         */
+        [[nodiscard]] auto contains(std::string_view p_header_name) const noexcept -> bool;
+
+        /**
+         * \brief Returns value of the first well-known header with specified identifier.
+         * \param p_header_id http::HeaderId
+         * \return std::optional< std::string_view > which is valid while headers are not modified.
+         */
+        [[nodiscard]] auto value(http::HeaderId p_header_id) const noexcept -> std::optional< std::string_view >;
+
+        /**
+         * \brief Returns values of all well-known headers with specified identifier in order of arrival.
+         * \param p_header_id http::HeaderId
+         * \return std::vector< std::string_view > which are valid while headers are not modified.
+         */
+        [[nodiscard]] auto values(http::HeaderId p_header_id) const -> std::vector< std::string_view >;
+
+        /**
+         * \brief Returns true if well-known header with specified identifier is present.
+         * \param p_header_id http::HeaderId
+         * \return bool
+         */
+        [[nodiscard]] auto contains(http::HeaderId p_header_id) const noexcept -> bool;
+
         /**
          * \brief Returns if header list is empty
          * \return bool
          */
-        [[nodiscard]] auto empty() -> bool;
+        [[nodiscard]] auto empty() const noexcept -> bool;
 
         /**
          * \brief Returns iterator begin
-         * \return std::vector< Header >::iterator
+         * \return std::vector< Header >::const_iterator
          */
-        [[nodiscard]] auto begin() noexcept -> std::vector< Header >::iterator;
+        [[nodiscard]] auto begin() const noexcept -> std::vector< Header >::const_iterator;
 
         /**
          * \brief Returns const_iterator begin
@@ -92,7 +147,7 @@ namespace tristan::network {
          * \brief Returns iterator end
          * \return std::vector< Header >::const_iterator
          */
-        [[nodiscard]] auto end() noexcept -> std::vector< Header >::iterator;
+        [[nodiscard]] auto end() const noexcept -> std::vector< Header >::const_iterator;
 
 
         /**
@@ -103,6 +158,15 @@ namespace tristan::network {
 
     private:
         std::vector< Header > m_headers;
+
+        std::vector< uint32_t > m_name_hashes;
+
+        std::vector< http::HeaderId > m_ids;
+
+        void _addHeader(Header&& p_header, uint32_t p_name_hash, http::HeaderId p_id);
+
+        [[nodiscard]] auto _find(std::string_view p_header_name, size_t p_from) const noexcept -> size_t;
+        [[nodiscard]] auto _find(http::HeaderId p_header_id, size_t p_from) const noexcept -> size_t;
     };
 
 }  // namespace tristan::network
@@ -1,114 +1,509 @@
 #ifndef HTTP_HEADER_NAMES_HPP
 #define HTTP_HEADER_NAMES_HPP
 
-#include <string>
-
-namespace tristan::network::http::header_names {
-    
-    [[maybe_unused]] inline const std::string a_im = "A-IM";
-    [[maybe_unused]] inline const std::string accept = "accept";
-    [[maybe_unused]] inline const std::string accept_charset = "accept-charset";
-    [[maybe_unused]] inline const std::string accept_datetime = "accept-datetime";
-    [[maybe_unused]] inline const std::string accept_encoding = "accept-encoding";
-    [[maybe_unused]] inline const std::string accept_language = "accept-language";
-    [[maybe_unused]] inline const std::string access_control_allow_credentials = "access-control-allow-credentials";
-    [[maybe_unused]] inline const std::string access_control_allow_headers = "access-control-allow-headers";
-    [[maybe_unused]] inline const std::string access_control_allow_methods = "access-control-allow-methods";
-    [[maybe_unused]] inline const std::string access_control_allow_origin = "access-control-allow-origin";
-    [[maybe_unused]] inline const std::string access_control_expose_headers = "access-control-expose-headers";
-    [[maybe_unused]] inline const std::string access_control_max_age = "access-control-max-age";
-    [[maybe_unused]] inline const std::string access_control_request_method = "access-control-request-method";
-    [[maybe_unused]] inline const std::string access_control_request_headers = "access-control-request-headers";
-    [[maybe_unused]] inline const std::string accept_patch = "accept-patch";
-    [[maybe_unused]] inline const std::string accept_ranges = "accept-ranges";
-    [[maybe_unused]] inline const std::string age = "age";
-    [[maybe_unused]] inline const std::string allow = "allow";
-    [[maybe_unused]] inline const std::string alt_svc = "alt-svc";
-    [[maybe_unused]] inline const std::string alternate_protocol = "alternate-protocol";
-    [[maybe_unused]] inline const std::string authorization = "authorization";
-    [[maybe_unused]] inline const std::string cache_control = "cache-control";
-    [[maybe_unused]] inline const std::string client_date = "client-date";
-    [[maybe_unused]] inline const std::string client_peer = "client-peer";
-    [[maybe_unused]] inline const std::string client_response_num = "client-response-num";
-    [[maybe_unused]] inline const std::string connection = "connection";
-    [[maybe_unused]] inline const std::string content_disposition = "content-disposition";
-    [[maybe_unused]] inline const std::string content_encoding = "content-encoding";
-    [[maybe_unused]] inline const std::string content_language = "content-language";
-    [[maybe_unused]] inline const std::string content_length = "content-length";
-    [[maybe_unused]] inline const std::string content_location = "content-location";
-    [[maybe_unused]] inline const std::string content_md_5 = "content-md5";
-    [[maybe_unused]] inline const std::string content_range = "content-range";
-    [[maybe_unused]] inline const std::string content_security_policy = "content-security-policy";
-    [[maybe_unused]] inline const std::string content_security_policy_report_only = "content-security-policy-report-only";
-    [[maybe_unused]] inline const std::string content_type = "content-type";
-    [[maybe_unused]] inline const std::string date = "date";
-    [[maybe_unused]] inline const std::string delta_base = "delta-base";
-    [[maybe_unused]] inline const std::string dnt = "DNT";
-    [[maybe_unused]] inline const std::string etag = "etag";
-    [[maybe_unused]] inline const std::string expect = "expect";
-    [[maybe_unused]] inline const std::string expires = "expires";
-    [[maybe_unused]] inline const std::string forwarded = "forwarded";
-    [[maybe_unused]] inline const std::string from = "from";
-    [[maybe_unused]] inline const std::string front_end_https = "front-end-https";
-    [[maybe_unused]] inline const std::string host = "host";
-    [[maybe_unused]] inline const std::string http_2_settings = "HTTP2-settings";
-    [[maybe_unused]] inline const std::string im = "IM";
-    [[maybe_unused]] inline const std::string if_match = "if-match";
-    [[maybe_unused]] inline const std::string if_modified_since = "if-modified-since";
-    [[maybe_unused]] inline const std::string if_none_match = "if-none-match";
-    [[maybe_unused]] inline const std::string if_range = "if-range";
-    [[maybe_unused]] inline const std::string if_unmodified_since = "if-unmodified-since";
-    [[maybe_unused]] inline const std::string keep_alive = "keep-alive";
-    [[maybe_unused]] inline const std::string last_modified = "last-modified";
-    [[maybe_unused]] inline const std::string link = "link";
-    [[maybe_unused]] inline const std::string location = "location";
-    [[maybe_unused]] inline const std::string max_forwards = "max-forwards";
-    [[maybe_unused]] inline const std::string origin = "origin";
-    [[maybe_unused]] inline const std::string p_3_p = "p3p";
-    [[maybe_unused]] inline const std::string pragma = "pragma";
-    [[maybe_unused]] inline const std::string prefer = "prefer";
-    [[maybe_unused]] inline const std::string preference_applied = "preference-applied";
-    [[maybe_unused]] inline const std::string proxy_authenticate = "proxy-authenticate";
-    [[maybe_unused]] inline const std::string proxy_authorization = "proxy-authorization";
-    [[maybe_unused]] inline const std::string proxy_connection = "proxy-connection";
-    [[maybe_unused]] inline const std::string public_key_pins = "public-key-pins";
-    [[maybe_unused]] inline const std::string range = "range";
-    [[maybe_unused]] inline const std::string referer = "referer";
-    [[maybe_unused]] inline const std::string refresh = "refresh";
-    [[maybe_unused]] inline const std::string retry_after = "retry-after";
-    [[maybe_unused]] inline const std::string server = "server";
-    [[maybe_unused]] inline const std::string set_cookie = "set-cookie";
-    [[maybe_unused]] inline const std::string status = "status";
-    [[maybe_unused]] inline const std::string strict_transport_security = "strict-transport-security";
-    [[maybe_unused]] inline const std::string timing_allow_origin = "timing-allow-origin";
-    [[maybe_unused]] inline const std::string tk = "tk";
-    [[maybe_unused]] inline const std::string trailer = "trailer";
-    [[maybe_unused]] inline const std::string transfer_encoding = "transfer-encoding";
-    [[maybe_unused]] inline const std::string upgrade = "upgrade";
-    [[maybe_unused]] inline const std::string upgrade_insecure_requests = "upgrade-insecure-requests";
-    [[maybe_unused]] inline const std::string user_agent = "user-agent";
-    [[maybe_unused]] inline const std::string vary = "vary";
-    [[maybe_unused]] inline const std::string via = "via";
-    [[maybe_unused]] inline const std::string warning = "warning";
-    [[maybe_unused]] inline const std::string www_authenticate = "www-authenticate";
-    [[maybe_unused]] inline const std::string x_aspnet_version = "x-aspnet-version";
-    [[maybe_unused]] inline const std::string x_content_type_options = "x-content-type-options";
-    [[maybe_unused]] inline const std::string x_content_security_policy = "x-content-security-policy";
-    [[maybe_unused]] inline const std::string x_forwarded_for = "x-forwarded-for";
-    [[maybe_unused]] inline const std::string x_forwarded_host = "x-forwarded-host";
-    [[maybe_unused]] inline const std::string x_forwarded_proto = "x-forwarded-proto";
-    [[maybe_unused]] inline const std::string x_frame_options = "x-frame-options";
-    [[maybe_unused]] inline const std::string x_http_method_override = "x-http-method-override";
-    [[maybe_unused]] inline const std::string x_permitted_cross_domain_policies = "x-permitted-cross-domain-policies";
-    [[maybe_unused]] inline const std::string x_pingback = "x-pingback";
-    [[maybe_unused]] inline const std::string x_powered_by = "x-powered-by";
-    [[maybe_unused]] inline const std::string x_requested_with = "x-requested-with";
-    [[maybe_unused]] inline const std::string x_robots_tag = "x-robots-tag";
-    [[maybe_unused]] inline const std::string x_ua_compatible = "x-ua-compatible";
-    [[maybe_unused]] inline const std::string x_webrit_csp = "x-webrit-csp";
-    [[maybe_unused]] inline const std::string x_xss_protection = "x-xss-protection";
-
-
-} // namespace tristan::network::http::header_names
+#include <string_view>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace tristan::network::http {
+
+    /**
+     * \brief Returns case-insensitive FNV-1a hash of the header name.
+     * \param p_header_name std::string_view
+     * \return uint32_t
+     */
+    [[nodiscard]] constexpr auto headerNameHash(std::string_view p_header_name) noexcept -> uint32_t {
+        uint32_t hash = 2166136261U;
+        for (auto character: p_header_name) {
+            if (character >= 'A' && character <= 'Z') {
+                character = static_cast< char >(character - 'A' + 'a');
+            }
+            hash ^= static_cast< uint8_t >(character);
+            hash *= 16777619U;
+        }
+        return hash;
+    }
+
+    /**
+     * \brief Compares two header names ignoring ASCII case.
+     * \param p_left std::string_view
+     * \param p_right std::string_view
+     * \return bool
+     */
+    [[nodiscard]] constexpr auto headerNamesEqual(std::string_view p_left, std::string_view p_right) noexcept -> bool {
+        if (p_left.size() != p_right.size()) {
+            return false;
+        }
+        for (size_t index = 0; index < p_left.size(); ++index) {
+            auto left = p_left[index];
+            auto right = p_right[index];
+            if (left >= 'A' && left <= 'Z') {
+                left = static_cast< char >(left - 'A' + 'a');
+            }
+            if (right >= 'A' && right <= 'Z') {
+                right = static_cast< char >(right - 'A' + 'a');
+            }
+            if (left != right) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * \enum HeaderId
+     * \brief Identifiers of well-known header names. UNKNOWN is used for every other header name.
+     */
+    enum class HeaderId : uint8_t {
+        A_IM,
+        ACCEPT,
+        ACCEPT_CHARSET,
+        ACCEPT_DATETIME,
+        ACCEPT_ENCODING,
+        ACCEPT_LANGUAGE,
+        ACCESS_CONTROL_ALLOW_CREDENTIALS,
+        ACCESS_CONTROL_ALLOW_HEADERS,
+        ACCESS_CONTROL_ALLOW_METHODS,
+        ACCESS_CONTROL_ALLOW_ORIGIN,
+        ACCESS_CONTROL_EXPOSE_HEADERS,
+        ACCESS_CONTROL_MAX_AGE,
+        ACCESS_CONTROL_REQUEST_METHOD,
+        ACCESS_CONTROL_REQUEST_HEADERS,
+        ACCEPT_PATCH,
+        ACCEPT_RANGES,
+        AGE,
+        ALLOW,
+        ALT_SVC,
+        ALTERNATE_PROTOCOL,
+        AUTHORIZATION,
+        CACHE_CONTROL,
+        CLIENT_DATE,
+        CLIENT_PEER,
+        CLIENT_RESPONSE_NUM,
+        CONNECTION,
+        CONTENT_DISPOSITION,
+        CONTENT_ENCODING,
+        CONTENT_LANGUAGE,
+        CONTENT_LENGTH,
+        CONTENT_LOCATION,
+        CONTENT_MD_5,
+        CONTENT_RANGE,
+        CONTENT_SECURITY_POLICY,
+        CONTENT_SECURITY_POLICY_REPORT_ONLY,
+        CONTENT_TYPE,
+        DATE,
+        DELTA_BASE,
+        DNT,
+        ETAG,
+        EXPECT,
+        EXPIRES,
+        FORWARDED,
+        FROM,
+        FRONT_END_HTTPS,
+        HOST,
+        HTTP_2_SETTINGS,
+        IM,
+        IF_MATCH,
+        IF_MODIFIED_SINCE,
+        IF_NONE_MATCH,
+        IF_RANGE,
+        IF_UNMODIFIED_SINCE,
+        KEEP_ALIVE,
+        LAST_MODIFIED,
+        LINK,
+        LOCATION,
+        MAX_FORWARDS,
+        ORIGIN,
+        P_3_P,
+        PRAGMA,
+        PREFER,
+        PREFERENCE_APPLIED,
+        PROXY_AUTHENTICATE,
+        PROXY_AUTHORIZATION,
+        PROXY_CONNECTION,
+        PUBLIC_KEY_PINS,
+        RANGE,
+        REFERER,
+        REFRESH,
+        RETRY_AFTER,
+        SERVER,
+        SET_COOKIE,
+        STATUS,
+        STRICT_TRANSPORT_SECURITY,
+        TIMING_ALLOW_ORIGIN,
+        TK,
+        TRAILER,
+        TRANSFER_ENCODING,
+        UPGRADE,
+        UPGRADE_INSECURE_REQUESTS,
+        USER_AGENT,
+        VARY,
+        VIA,
+        WARNING,
+        WWW_AUTHENTICATE,
+        X_ASPNET_VERSION,
+        X_CONTENT_TYPE_OPTIONS,
+        X_CONTENT_SECURITY_POLICY,
+        X_FORWARDED_FOR,
+        X_FORWARDED_HOST,
+        X_FORWARDED_PROTO,
+        X_FRAME_OPTIONS,
+        X_HTTP_METHOD_OVERRIDE,
+        X_PERMITTED_CROSS_DOMAIN_POLICIES,
+        X_PINGBACK,
+        X_POWERED_BY,
+        X_REQUESTED_WITH,
+        X_ROBOTS_TAG,
+        X_UA_COMPATIBLE,
+        X_WEBRIT_CSP,
+        X_XSS_PROTECTION,
+        UNKNOWN
+    };
+
+    namespace header_names {
+
+        [[maybe_unused]] inline constexpr std::string_view a_im = "A-IM";
+        [[maybe_unused]] inline constexpr std::string_view accept = "accept";
+        [[maybe_unused]] inline constexpr std::string_view accept_charset = "accept-charset";
+        [[maybe_unused]] inline constexpr std::string_view accept_datetime = "accept-datetime";
+        [[maybe_unused]] inline constexpr std::string_view accept_encoding = "accept-encoding";
+        [[maybe_unused]] inline constexpr std::string_view accept_language = "accept-language";
+        [[maybe_unused]] inline constexpr std::string_view access_control_allow_credentials = "access-control-allow-credentials";
+        [[maybe_unused]] inline constexpr std::string_view access_control_allow_headers = "access-control-allow-headers";
+        [[maybe_unused]] inline constexpr std::string_view access_control_allow_methods = "access-control-allow-methods";
+        [[maybe_unused]] inline constexpr std::string_view access_control_allow_origin = "access-control-allow-origin";
+        [[maybe_unused]] inline constexpr std::string_view access_control_expose_headers = "access-control-expose-headers";
+        [[maybe_unused]] inline constexpr std::string_view access_control_max_age = "access-control-max-age";
+        [[maybe_unused]] inline constexpr std::string_view access_control_request_method = "access-control-request-method";
+        [[maybe_unused]] inline constexpr std::string_view access_control_request_headers = "access-control-request-headers";
+        [[maybe_unused]] inline constexpr std::string_view accept_patch = "accept-patch";
+        [[maybe_unused]] inline constexpr std::string_view accept_ranges = "accept-ranges";
+        [[maybe_unused]] inline constexpr std::string_view age = "age";
+        [[maybe_unused]] inline constexpr std::string_view allow = "allow";
+        [[maybe_unused]] inline constexpr std::string_view alt_svc = "alt-svc";
+        [[maybe_unused]] inline constexpr std::string_view alternate_protocol = "alternate-protocol";
+        [[maybe_unused]] inline constexpr std::string_view authorization = "authorization";
+        [[maybe_unused]] inline constexpr std::string_view cache_control = "cache-control";
+        [[maybe_unused]] inline constexpr std::string_view client_date = "client-date";
+        [[maybe_unused]] inline constexpr std::string_view client_peer = "client-peer";
+        [[maybe_unused]] inline constexpr std::string_view client_response_num = "client-response-num";
+        [[maybe_unused]] inline constexpr std::string_view connection = "connection";
+        [[maybe_unused]] inline constexpr std::string_view content_disposition = "content-disposition";
+        [[maybe_unused]] inline constexpr std::string_view content_encoding = "content-encoding";
+        [[maybe_unused]] inline constexpr std::string_view content_language = "content-language";
+        [[maybe_unused]] inline constexpr std::string_view content_length = "content-length";
+        [[maybe_unused]] inline constexpr std::string_view content_location = "content-location";
+        [[maybe_unused]] inline constexpr std::string_view content_md_5 = "content-md5";
+        [[maybe_unused]] inline constexpr std::string_view content_range = "content-range";
+        [[maybe_unused]] inline constexpr std::string_view content_security_policy = "content-security-policy";
+        [[maybe_unused]] inline constexpr std::string_view content_security_policy_report_only = "content-security-policy-report-only";
+        [[maybe_unused]] inline constexpr std::string_view content_type = "content-type";
+        [[maybe_unused]] inline constexpr std::string_view date = "date";
+        [[maybe_unused]] inline constexpr std::string_view delta_base = "delta-base";
+        [[maybe_unused]] inline constexpr std::string_view dnt = "DNT";
+        [[maybe_unused]] inline constexpr std::string_view etag = "etag";
+        [[maybe_unused]] inline constexpr std::string_view expect = "expect";
+        [[maybe_unused]] inline constexpr std::string_view expires = "expires";
+        [[maybe_unused]] inline constexpr std::string_view forwarded = "forwarded";
+        [[maybe_unused]] inline constexpr std::string_view from = "from";
+        [[maybe_unused]] inline constexpr std::string_view front_end_https = "front-end-https";
+        [[maybe_unused]] inline constexpr std::string_view host = "host";
+        [[maybe_unused]] inline constexpr std::string_view http_2_settings = "HTTP2-settings";
+        [[maybe_unused]] inline constexpr std::string_view im = "IM";
+        [[maybe_unused]] inline constexpr std::string_view if_match = "if-match";
+        [[maybe_unused]] inline constexpr std::string_view if_modified_since = "if-modified-since";
+        [[maybe_unused]] inline constexpr std::string_view if_none_match = "if-none-match";
+        [[maybe_unused]] inline constexpr std::string_view if_range = "if-range";
+        [[maybe_unused]] inline constexpr std::string_view if_unmodified_since = "if-unmodified-since";
+        [[maybe_unused]] inline constexpr std::string_view keep_alive = "keep-alive";
+        [[maybe_unused]] inline constexpr std::string_view last_modified = "last-modified";
+        [[maybe_unused]] inline constexpr std::string_view link = "link";
+        [[maybe_unused]] inline constexpr std::string_view location = "location";
+        [[maybe_unused]] inline constexpr std::string_view max_forwards = "max-forwards";
+        [[maybe_unused]] inline constexpr std::string_view origin = "origin";
+        [[maybe_unused]] inline constexpr std::string_view p_3_p = "p3p";
+        [[maybe_unused]] inline constexpr std::string_view pragma = "pragma";
+        [[maybe_unused]] inline constexpr std::string_view prefer = "prefer";
+        [[maybe_unused]] inline constexpr std::string_view preference_applied = "preference-applied";
+        [[maybe_unused]] inline constexpr std::string_view proxy_authenticate = "proxy-authenticate";
+        [[maybe_unused]] inline constexpr std::string_view proxy_authorization = "proxy-authorization";
+        [[maybe_unused]] inline constexpr std::string_view proxy_connection = "proxy-connection";
+        [[maybe_unused]] inline constexpr std::string_view public_key_pins = "public-key-pins";
+        [[maybe_unused]] inline constexpr std::string_view range = "range";
+        [[maybe_unused]] inline constexpr std::string_view referer = "referer";
+        [[maybe_unused]] inline constexpr std::string_view refresh = "refresh";
+        [[maybe_unused]] inline constexpr std::string_view retry_after = "retry-after";
+        [[maybe_unused]] inline constexpr std::string_view server = "server";
+        [[maybe_unused]] inline constexpr std::string_view set_cookie = "set-cookie";
+        [[maybe_unused]] inline constexpr std::string_view status = "status";
+        [[maybe_unused]] inline constexpr std::string_view strict_transport_security = "strict-transport-security";
+        [[maybe_unused]] inline constexpr std::string_view timing_allow_origin = "timing-allow-origin";
+        [[maybe_unused]] inline constexpr std::string_view tk = "tk";
+        [[maybe_unused]] inline constexpr std::string_view trailer = "trailer";
+        [[maybe_unused]] inline constexpr std::string_view transfer_encoding = "transfer-encoding";
+        [[maybe_unused]] inline constexpr std::string_view upgrade = "upgrade";
+        [[maybe_unused]] inline constexpr std::string_view upgrade_insecure_requests = "upgrade-insecure-requests";
+        [[maybe_unused]] inline constexpr std::string_view user_agent = "user-agent";
+        [[maybe_unused]] inline constexpr std::string_view vary = "vary";
+        [[maybe_unused]] inline constexpr std::string_view via = "via";
+        [[maybe_unused]] inline constexpr std::string_view warning = "warning";
+        [[maybe_unused]] inline constexpr std::string_view www_authenticate = "www-authenticate";
+        [[maybe_unused]] inline constexpr std::string_view x_aspnet_version = "x-aspnet-version";
+        [[maybe_unused]] inline constexpr std::string_view x_content_type_options = "x-content-type-options";
+        [[maybe_unused]] inline constexpr std::string_view x_content_security_policy = "x-content-security-policy";
+        [[maybe_unused]] inline constexpr std::string_view x_forwarded_for = "x-forwarded-for";
+        [[maybe_unused]] inline constexpr std::string_view x_forwarded_host = "x-forwarded-host";
+        [[maybe_unused]] inline constexpr std::string_view x_forwarded_proto = "x-forwarded-proto";
+        [[maybe_unused]] inline constexpr std::string_view x_frame_options = "x-frame-options";
+        [[maybe_unused]] inline constexpr std::string_view x_http_method_override = "x-http-method-override";
+        [[maybe_unused]] inline constexpr std::string_view x_permitted_cross_domain_policies = "x-permitted-cross-domain-policies";
+        [[maybe_unused]] inline constexpr std::string_view x_pingback = "x-pingback";
+        [[maybe_unused]] inline constexpr std::string_view x_powered_by = "x-powered-by";
+        [[maybe_unused]] inline constexpr std::string_view x_requested_with = "x-requested-with";
+        [[maybe_unused]] inline constexpr std::string_view x_robots_tag = "x-robots-tag";
+        [[maybe_unused]] inline constexpr std::string_view x_ua_compatible = "x-ua-compatible";
+        [[maybe_unused]] inline constexpr std::string_view x_webrit_csp = "x-webrit-csp";
+        [[maybe_unused]] inline constexpr std::string_view x_xss_protection = "x-xss-protection";
+
+    }  // namespace header_names
+
+    /**
+     * \brief Well-known header names indexed by HeaderId.
+     */
+    inline constexpr std::array< std::string_view, static_cast< size_t >(HeaderId::UNKNOWN) > known_header_names = {
+        header_names::a_im,
+        header_names::accept,
+        header_names::accept_charset,
+        header_names::accept_datetime,
+        header_names::accept_encoding,
+        header_names::accept_language,
+        header_names::access_control_allow_credentials,
+        header_names::access_control_allow_headers,
+        header_names::access_control_allow_methods,
+        header_names::access_control_allow_origin,
+        header_names::access_control_expose_headers,
+        header_names::access_control_max_age,
+        header_names::access_control_request_method,
+        header_names::access_control_request_headers,
+        header_names::accept_patch,
+        header_names::accept_ranges,
+        header_names::age,
+        header_names::allow,
+        header_names::alt_svc,
+        header_names::alternate_protocol,
+        header_names::authorization,
+        header_names::cache_control,
+        header_names::client_date,
+        header_names::client_peer,
+        header_names::client_response_num,
+        header_names::connection,
+        header_names::content_disposition,
+        header_names::content_encoding,
+        header_names::content_language,
+        header_names::content_length,
+        header_names::content_location,
+        header_names::content_md_5,
+        header_names::content_range,
+        header_names::content_security_policy,
+        header_names::content_security_policy_report_only,
+        header_names::content_type,
+        header_names::date,
+        header_names::delta_base,
+        header_names::dnt,
+        header_names::etag,
+        header_names::expect,
+        header_names::expires,
+        header_names::forwarded,
+        header_names::from,
+        header_names::front_end_https,
+        header_names::host,
+        header_names::http_2_settings,
+        header_names::im,
+        header_names::if_match,
+        header_names::if_modified_since,
+        header_names::if_none_match,
+        header_names::if_range,
+        header_names::if_unmodified_since,
+        header_names::keep_alive,
+        header_names::last_modified,
+        header_names::link,
+        header_names::location,
+        header_names::max_forwards,
+        header_names::origin,
+        header_names::p_3_p,
+        header_names::pragma,
+        header_names::prefer,
+        header_names::preference_applied,
+        header_names::proxy_authenticate,
+        header_names::proxy_authorization,
+        header_names::proxy_connection,
+        header_names::public_key_pins,
+        header_names::range,
+        header_names::referer,
+        header_names::refresh,
+        header_names::retry_after,
+        header_names::server,
+        header_names::set_cookie,
+        header_names::status,
+        header_names::strict_transport_security,
+        header_names::timing_allow_origin,
+        header_names::tk,
+        header_names::trailer,
+        header_names::transfer_encoding,
+        header_names::upgrade,
+        header_names::upgrade_insecure_requests,
+        header_names::user_agent,
+        header_names::vary,
+        header_names::via,
+        header_names::warning,
+        header_names::www_authenticate,
+        header_names::x_aspnet_version,
+        header_names::x_content_type_options,
+        header_names::x_content_security_policy,
+        header_names::x_forwarded_for,
+        header_names::x_forwarded_host,
+        header_names::x_forwarded_proto,
+        header_names::x_frame_options,
+        header_names::x_http_method_override,
+        header_names::x_permitted_cross_domain_policies,
+        header_names::x_pingback,
+        header_names::x_powered_by,
+        header_names::x_requested_with,
+        header_names::x_robots_tag,
+        header_names::x_ua_compatible,
+        header_names::x_webrit_csp,
+        header_names::x_xss_protection
+    };
+
+    namespace private_ {
+
+        inline constexpr size_t header_id_buckets_count = 32;
+        inline constexpr size_t header_id_slots_count = 128;
+
+        static_assert(known_header_names.size() <= header_id_slots_count);
+
+        /**
+         * \struct HeaderIdTable
+         * \brief Perfect hash of the well-known header names. Name hash selects a bucket, bucket displacement selects a slot.
+         */
+        struct HeaderIdTable {
+            std::array< uint16_t, header_id_buckets_count > m_displacements{};
+            std::array< HeaderId, header_id_slots_count > m_slots{};
+            bool m_valid = false;
+        };
+
+        [[nodiscard]] constexpr auto headerIdBucket(uint32_t p_hash) noexcept -> size_t { return p_hash % header_id_buckets_count; }
+
+        [[nodiscard]] constexpr auto headerIdSlot(uint32_t p_hash, uint16_t p_displacement) noexcept -> size_t {
+            //Murmur3 finalizer spreads the name hash over the slots for every displacement.
+            uint32_t hash = p_hash ^ (static_cast< uint32_t >(p_displacement) * 0x9e3779b9U);
+            hash ^= hash >> 16;
+            hash *= 0x85ebca6bU;
+            hash ^= hash >> 13;
+            hash *= 0xc2b2ae35U;
+            hash ^= hash >> 16;
+            return hash % header_id_slots_count;
+        }
+
+        [[nodiscard]] constexpr auto buildHeaderIdTable() noexcept -> HeaderIdTable {
+            HeaderIdTable table;
+            table.m_slots.fill(HeaderId::UNKNOWN);
+
+            std::array< uint32_t, known_header_names.size() > hashes{};
+            std::array< size_t, header_id_buckets_count > buckets_sizes{};
+            for (size_t index = 0; index < known_header_names.size(); ++index) {
+                hashes[index] = headerNameHash(known_header_names[index]);
+                ++buckets_sizes[headerIdBucket(hashes[index])];
+            }
+
+            //Largest buckets are placed first while most of the slots are still free.
+            std::array< bool, header_id_buckets_count > placed{};
+            for (size_t round = 0; round < header_id_buckets_count; ++round) {
+                size_t bucket = header_id_buckets_count;
+                for (size_t candidate = 0; candidate < header_id_buckets_count; ++candidate) {
+                    if (not placed[candidate] && (bucket == header_id_buckets_count || buckets_sizes[candidate] > buckets_sizes[bucket])) {
+                        bucket = candidate;
+                    }
+                }
+                placed[bucket] = true;
+                if (buckets_sizes[bucket] == 0) {
+                    continue;
+                }
+                bool bucket_placed = false;
+                for (uint32_t displacement = 0; displacement <= UINT16_MAX && not bucket_placed; ++displacement) {
+                    auto slots = table.m_slots;
+                    bucket_placed = true;
+                    for (size_t index = 0; index < known_header_names.size(); ++index) {
+                        if (headerIdBucket(hashes[index]) != bucket) {
+                            continue;
+                        }
+                        auto slot = headerIdSlot(hashes[index], static_cast< uint16_t >(displacement));
+                        if (slots[slot] != HeaderId::UNKNOWN) {
+                            bucket_placed = false;
+                            break;
+                        }
+                        slots[slot] = static_cast< HeaderId >(index);
+                    }
+                    if (bucket_placed) {
+                        table.m_slots = slots;
+                        table.m_displacements[bucket] = static_cast< uint16_t >(displacement);
+                    }
+                }
+                if (not bucket_placed) {
+                    return table;
+                }
+            }
+            table.m_valid = true;
+            return table;
+        }
+
+        inline constexpr HeaderIdTable header_id_table = buildHeaderIdTable();
+
+        static_assert(header_id_table.m_valid, "Well-known header names do not fit perfect hash table");
+
+    }  // namespace private_
+
+    /**
+     * \brief Returns identifier of the header name which hash is already known.
+     * \param p_header_name std::string_view
+     * \param p_header_name_hash uint32_t which is headerNameHash(p_header_name)
+     * \return HeaderId, HeaderId::UNKNOWN if name is not well-known.
+     */
+    [[nodiscard]] constexpr auto headerId(std::string_view p_header_name, uint32_t p_header_name_hash) noexcept -> HeaderId {
+        auto displacement = private_::header_id_table.m_displacements[private_::headerIdBucket(p_header_name_hash)];
+        auto id = private_::header_id_table.m_slots[private_::headerIdSlot(p_header_name_hash, displacement)];
+        if (id == HeaderId::UNKNOWN || not headerNamesEqual(known_header_names[static_cast< size_t >(id)], p_header_name)) {
+            return HeaderId::UNKNOWN;
+        }
+        return id;
+    }
+
+    /**
+     * \brief Returns identifier of the header name.
+     * \param p_header_name std::string_view
+     * \return HeaderId, HeaderId::UNKNOWN if name is not well-known.
+     */
+    [[nodiscard]] constexpr auto headerId(std::string_view p_header_name) noexcept -> HeaderId {
+        return headerId(p_header_name, headerNameHash(p_header_name));
+    }
+
+    /**
+     * \brief Returns name of the well-known header.
+     * \param p_header_id HeaderId
+     * \return std::string_view, empty for HeaderId::UNKNOWN.
+     */
+    [[nodiscard]] constexpr auto headerName(HeaderId p_header_id) noexcept -> std::string_view {
+        if (p_header_id == HeaderId::UNKNOWN) {
+            return {};
+        }
+        return known_header_names[static_cast< size_t >(p_header_id)];
+    }
+
+    static_assert(headerId(header_names::content_length) == HeaderId::CONTENT_LENGTH);
+    static_assert(headerId("Content-Length") == HeaderId::CONTENT_LENGTH);
+    static_assert(headerId("x-not-well-known") == HeaderId::UNKNOWN);
+
+}  // namespace tristan::network::http
 
 #endif // HTTP_HEADER_NAMES_HPP
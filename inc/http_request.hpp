@@ -20,6 +20,16 @@
 
 namespace tristan::network{
 
+    /**
+     * \struct FileBody
+     * \brief Part of the file which is sent as a request body.
+     */
+    struct FileBody {
+        std::filesystem::path m_path;
+        uint64_t m_offset;
+        uint64_t m_length;
+    };
+
     /**
      * \class HttpRequest
      * \extends TcpRequest
@@ -41,6 +51,18 @@ namespace tristan::network{
         void addParam(Parameter&& parameter);
 
         void initResponse(std::vector<uint8_t>&& headers_data);
+
+        /**
+         * \brief Creates response from the parsed headers. Sets request error if headers are malformed.
+         * \param p_parser const HttpResponseParser&
+         */
+        void initResponse(const HttpResponseParser& p_parser);
+
+        /**
+         * \brief Returns file which is streamed as a request body after requestBuffers().
+         * \return const std::optional< FileBody >&
+         */
+        [[nodiscard]] auto bodyFile() const noexcept -> const std::optional< FileBody >&;
       protected:
 
         /**
@@ -52,6 +74,7 @@ namespace tristan::network{
         ~HttpRequest() override = default;
         HttpHeaders m_headers;
         HttpParams m_params;
+        std::optional< FileBody > m_body_file;
         bool m_request_composed;
     };
 
@@ -96,14 +119,36 @@ namespace tristan::network{
         void setBody(std::string&& p_body);
         void setBody(const std::string& p_body);
 
+        /**
+         * \brief Sets part of the file as a request body. The file is streamed directly to the socket while request is written.
+         * \param p_path const std::filesystem::path&
+         * \param p_offset uint64_t
+         * \param p_length uint64_t. Default value is 0 which means till the end of the file.
+         * \note Content-Length is computed from the file size when this function is invoked.
+         */
+        void setBodyFromFile(const std::filesystem::path& p_path, uint64_t p_offset = 0, uint64_t p_length = 0);
+
         /**
         * \brief Prepares std::vector<uint8_t> representation of the request.
         * \implements TcpRequest::requestData()
         * \return const std::vector<uint8_t>&
+        * \note Body is moved into the returned vector, so requestBuffers() should be preferred for large bodies. Body set from file is not included.
         */
         auto requestData() -> const std::vector<uint8_t>& override;
+
+        /**
+        * \brief Returns request line with headers and the body as separate buffers so that the body is never copied.
+        * \return std::vector< std::span< const uint8_t > >
+        */
+        auto requestBuffers() -> std::vector< std::span< const uint8_t > > override;
     protected:
         std::string m_body;
+
+        /**
+         * \brief Composes request line and headers into m_request_data.
+         * \param p_method const std::string&
+         */
+        void _composeRequestHead(const std::string& p_method);
     };
 
 
@@ -123,11 +168,10 @@ namespace tristan::network{
         ~PutRequest() override = default;
 
         /**
-        * \brief Prepares std::vector<uint8_t> representation of the request.
-        * \implements TcpRequest::requestData()
-        * \return const std::vector<uint8_t>&
+        * \brief Returns request line with headers and the body as separate buffers so that the body is never copied.
+        * \return std::vector< std::span< const uint8_t > >
         */
-        auto requestData() -> const std::vector<uint8_t>& override;
+        auto requestBuffers() -> std::vector< std::span< const uint8_t > > override;
     };
 
 
@@ -23,21 +23,29 @@ namespace tristan::network {
 
         [[nodiscard]] static auto createResponse(std::string p_uuid, std::vector<uint8_t>&& p_headers_data) -> std::shared_ptr<HttpResponse>;
 
+        [[nodiscard]] static auto createResponse(std::string p_uuid, const HttpResponseParser& p_parser) -> std::shared_ptr<HttpResponse>;
+
         [[nodiscard]] auto error() const -> std::error_code;
 
         [[nodiscard]] auto status() const -> HttpStatus;
 
         [[nodiscard]] auto headers() const -> const std::unique_ptr<HttpHeaders>&;
 
+        [[nodiscard]] auto minorVersion() const -> uint8_t;
+
     protected:
     private:
         explicit HttpResponse(std::string&& p_string, std::vector<uint8_t>&& p_headers_data);
 
+        HttpResponse(std::string&& p_string, const HttpResponseParser& p_parser);
+
         std::error_code m_error;
 
         std::unique_ptr<HttpHeaders> m_response_headers;
 
         HttpStatus m_status;
+
+        uint8_t m_minor_version;
     };
 
 } //End of tristan::network namespace
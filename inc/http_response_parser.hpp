@@ -0,0 +1,185 @@
+#ifndef HTTP_RESPONSE_PARSER_HPP
+#define HTTP_RESPONSE_PARSER_HPP
+
+#include "http_header_names.hpp"
+
+#include <vector>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <cstdint>
+
+namespace tristan::network {
+
+    /**
+     * \class HttpResponseParser
+     * \brief Incremental parser of the HTTP/1.0 and HTTP/1.1 response status line and headers.
+     * Data may be fed in fragments of any size. Header names and values are stored as offsets into the single retained buffer.
+     * Malformed input is reported via error() and never throws.
+     * \Threadsafe No
+     */
+    class HttpResponseParser {
+    public:
+        /**
+         * \brief Maximum size of the status line with headers. Bigger responses are rejected with HTTP_HEADERS_TOO_LARGE error.
+         */
+        static constexpr size_t max_headers_size = 64 * 1024;
+
+        /**
+         * \enum State
+         * \brief Parser states
+         */
+        enum class State : uint8_t {
+            STATUS_LINE,
+            HEADERS,
+            DONE,
+            FAILED
+        };
+
+        /**
+         * \struct Field
+         * \brief Location of header name and value in data() with the name hash and the well-known header identifier.
+         */
+        struct Field {
+            uint32_t m_name_offset;
+            uint32_t m_name_length;
+            uint32_t m_value_offset;
+            uint32_t m_value_length;
+            uint32_t m_name_hash;
+            http::HeaderId m_id;
+        };
+
+        /**
+         * \brief Default constructor
+         */
+        HttpResponseParser();
+
+        HttpResponseParser(const HttpResponseParser& p_other) = delete;
+
+        /**
+         * \brief Move constructor
+         * \param p_other HttpResponseParser&&
+         */
+        HttpResponseParser(HttpResponseParser&& p_other) noexcept = default;
+
+        HttpResponseParser& operator=(const HttpResponseParser& p_other) = delete;
+
+        /**
+         * \brief Move assignment operator
+         * \param p_other HttpResponseParser&&
+         * \return HttpResponseParser&
+         */
+        HttpResponseParser& operator=(HttpResponseParser&& p_other) noexcept = default;
+
+        ~HttpResponseParser() = default;
+
+        /**
+         * \brief Parses the next fragment of the response.
+         * \param p_data std::span< const uint8_t >
+         * \return size_t number of bytes which belong to the headers. Bytes past the returned value belong to the response body.
+         */
+        auto consume(std::span< const uint8_t > p_data) -> size_t;
+
+        /**
+         * \brief Prepares parser for the next response.
+         */
+        void reset();
+
+        /**
+         * \brief Returns current state.
+         * \return State
+         */
+        [[nodiscard]] auto state() const noexcept -> State;
+
+        /**
+         * \brief Returns true if empty line which terminates headers was parsed.
+         * \return bool
+         */
+        [[nodiscard]] auto done() const noexcept -> bool;
+
+        /**
+         * \brief Returns true if malformed input was received.
+         * \return bool
+         */
+        [[nodiscard]] auto failed() const noexcept -> bool;
+
+        /**
+         * \brief Returns parsing error.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+        /**
+         * \brief Returns status code.
+         * \return uint16_t
+         */
+        [[nodiscard]] auto status() const noexcept -> uint16_t;
+
+        /**
+         * \brief Returns minor HTTP version, that is 0 for HTTP/1.0 and 1 for HTTP/1.1.
+         * \return uint8_t
+         */
+        [[nodiscard]] auto minorVersion() const noexcept -> uint8_t;
+
+        /**
+         * \brief Returns reason phrase.
+         * \return std::string_view
+         */
+        [[nodiscard]] auto reason() const noexcept -> std::string_view;
+
+        /**
+         * \brief Returns headers in order of arrival.
+         * \return const std::vector< Field >&
+         */
+        [[nodiscard]] auto fields() const noexcept -> const std::vector< Field >&;
+
+        /**
+         * \brief Returns header name as it was received.
+         * \param p_field const Field&
+         * \return std::string_view which is valid while parser data is not modified.
+         */
+        [[nodiscard]] auto name(const Field& p_field) const noexcept -> std::string_view;
+
+        /**
+         * \brief Returns header value without surrounding whitespaces.
+         * \param p_field const Field&
+         * \return std::string_view which is valid while parser data is not modified.
+         */
+        [[nodiscard]] auto value(const Field& p_field) const noexcept -> std::string_view;
+
+        /**
+         * \brief Returns retained bytes of the status line and headers.
+         * \return const std::vector< uint8_t >&
+         */
+        [[nodiscard]] auto data() const noexcept -> const std::vector< uint8_t >&;
+
+    protected:
+    private:
+        std::vector< uint8_t > m_data;
+
+        std::vector< Field > m_fields;
+
+        std::error_code m_error;
+
+        size_t m_line_start;
+
+        uint32_t m_reason_offset;
+
+        uint32_t m_reason_length;
+
+        uint16_t m_status;
+
+        uint8_t m_minor_version;
+
+        State m_state;
+
+        [[nodiscard]] auto _parseStatusLine(size_t p_begin, size_t p_end) -> bool;
+
+        [[nodiscard]] auto _parseHeaderLine(size_t p_begin, size_t p_end) -> bool;
+
+        void _fail(std::error_code p_error);
+    };
+
+}  // namespace tristan::network
+
+#endif  //HTTP_RESPONSE_PARSER_HPP
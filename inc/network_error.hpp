@@ -17,7 +17,8 @@ namespace tristan::network {
         ASYNC_NETWORK_REQUEST_HANDLER_LUNCHED_TWICE,
         ASYNC_NETWORK_REQUEST_HANDLER_WAS_NOT_LUNCHED,
         REQUEST_SIZE_IS_NOT_APPROPRIATE,
-        REQUEST_NOT_SUPPORTED
+        REQUEST_NOT_SUPPORTED,
+        REQUEST_HANDLER_STOPPED
     };
 
     enum class UrlErrors : uint8_t {
@@ -37,6 +38,8 @@ namespace tristan::network {
         SUCCESS,
         HTTP_BAD_RESPONSE_FORMAT,
         HTTP_RESPONSE_SIZE_ERROR,
+        HTTP_HEADERS_TOO_LARGE,
+        HTTP_BAD_CHUNKED_ENCODING,
     };
 
     /**
@@ -10,6 +10,7 @@
 #include <atomic>
 #include <fstream>
 #include <chrono>
+#include <span>
 
 namespace tristan::network {
 
@@ -21,6 +22,7 @@ namespace tristan::network {
         class SyncNetworkRequestHandlerImpl;
         class AsyncNetworkRequestHandlerImpl;
         class AsyncRequestHandler;
+        class RequestScheduler;
     } //End of private_ namespace
 
     /**
@@ -102,6 +104,7 @@ namespace tristan::network {
             friend class private_::SyncNetworkRequestHandlerImpl;
             friend class private_::AsyncNetworkRequestHandlerImpl;
             friend class private_::AsyncRequestHandler;
+            friend class private_::RequestScheduler;
             friend class NetworkRequestsHandler;
             explicit FriendClassesAPI(NetworkRequestBase& p_base) : m_base(p_base) {}
 
@@ -113,6 +116,25 @@ namespace tristan::network {
              */
             void addResponseData(std::vector< uint8_t >&& p_data);
 
+            /**
+             * \brief Reserves space for the response data
+             * \param p_size uint64_t
+             */
+            void reserveResponseData(uint64_t p_size);
+
+            /**
+             * \brief Returns buffer which socket may read into directly. The buffer is not larger than requested but may be smaller
+             * \param p_size uint64_t
+             * \return std::span< uint8_t >
+             */
+            [[nodiscard]] auto responseBuffer(uint64_t p_size) -> std::span< uint8_t >;
+
+            /**
+             * \brief Adds bytes which were read into the buffer returned by responseBuffer to response data
+             * \param p_size uint64_t
+             */
+            void commitResponseData(uint64_t p_size);
+
             /**
              * \brief Sets current request status
              * \param p_status Status
@@ -124,6 +146,18 @@ namespace tristan::network {
              * \param p_error_code std::error_code
              */
             void setError(std::error_code p_error_code);
+
+            /**
+             * \brief Returns link to the next request in the scheduler queue.
+             * \return std::shared_ptr<NetworkRequestBase>&
+             */
+            [[nodiscard]] auto nextInQueue() -> std::shared_ptr< NetworkRequestBase >&;
+
+            /**
+             * \brief Returns time when request was put into the scheduler queue.
+             * \return std::chrono::steady_clock::time_point&
+             */
+            [[nodiscard]] auto enqueuedAt() -> std::chrono::steady_clock::time_point&;
         };
 
     public:
@@ -179,6 +213,14 @@ namespace tristan::network {
          */
         void outputToFile(const std::filesystem::path& p_path);
 
+        /**
+         * \brief Sets if response data should be stored in the chain of pooled segments instead of the contiguous vector. By default is set to false.
+         * Segmented storage avoids reallocations and copying while large responses grow.
+         * \param p_value bool
+         * \note Has no effect if response is written to file.
+         */
+        void setSegmentedResponseStorage(bool p_value = true);
+
         /**
          * \brief Cancels the request execution.
          */
@@ -207,10 +249,46 @@ namespace tristan::network {
         void setRequest(const std::vector< uint8_t >& p_request_data);
 
         /**
-         * \brief Sets timeout for socket operations
-         * \param p_timeout std::chrono::seconds
+         * \brief Sets connect, first byte and idle timeouts to the same value. Default value is 5 seconds.
+         * \param p_timeout std::chrono::milliseconds. std::chrono::seconds values are converted implicitly.
+         */
+        void setTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Sets time within which connection should be established. Default value is 5 seconds.
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setConnectTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Sets time between the end of the request writing and the first byte of the response. Default value is 5 seconds.
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setFirstByteTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Sets time during which socket may not transfer any data once the transfer started. Default value is 5 seconds.
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setIdleTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Sets time within which the whole request should be processed. Default value is 0 which means no limit.
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setTotalTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Sets maximum number of bytes which are read from socket at once. Default value is 0 which means request handler default.
+         * \param p_size uint16_t
+         */
+        void setReadBufferSize(uint16_t p_size);
+
+        /**
+         * \brief Sets maximum number of bytes which are written to socket at once. Default value is 0 which means request handler default.
+         * \param p_size uint16_t
          */
-        void setTimeOut(std::chrono::seconds p_timeout);
+        void setWriteBufferSize(uint16_t p_size);
 
         /**
          * \brief Returned UUID of a request.
@@ -279,6 +357,14 @@ namespace tristan::network {
          */
         [[nodiscard]] virtual auto requestData() -> const std::vector< uint8_t >& = 0;
 
+        /**
+         * \brief Returns data which should be sent to the remote as the sequence of buffers which are written with a single vectored write.
+         * Default implementation returns requestData() as the only buffer.
+         * \return std::vector< std::span< const uint8_t > >
+         * \note Buffers are valid while the request is alive and not modified.
+         */
+        [[nodiscard]] virtual auto requestBuffers() -> std::vector< std::span< const uint8_t > >;
+
         /**
          * \brief Returns response which was returned by the remote.
          * If request was not processed an empty std::shared_ptr is returned.
@@ -286,7 +372,24 @@ namespace tristan::network {
          */
         [[nodiscard]] auto response() -> std::shared_ptr< NetworkResponse >;
 
-        [[nodiscard]] auto timeout() const -> std::chrono::seconds;
+        /**
+         * \brief Returns idle timeout.
+         * \return std::chrono::milliseconds
+         * \note Kept for compatibility, use idleTimeOut() instead.
+         */
+        [[nodiscard]] auto timeout() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto connectTimeOut() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto firstByteTimeOut() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto idleTimeOut() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto totalTimeOut() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto readBufferSize() const noexcept -> uint16_t;
+
+        [[nodiscard]] auto writeBufferSize() const noexcept -> uint16_t;
 
         /**
          * \brief Registers callback functions which will be invoked each time read bytes value is increased.
@@ -810,6 +913,27 @@ namespace tristan::network {
              */
         void addResponseData(std::vector< uint8_t >&& p_data);
 
+        /**
+             * \brief Reserves space for the response data when response is stored in memory
+             * \param p_size uint64_t
+             */
+        void reserveResponseData(uint64_t p_size);
+
+        /**
+             * \brief Returns buffer which socket may read into directly.
+             * With segmented storage the buffer is the tail of the last segment and may be smaller than requested since it never crosses the segment boundary.
+             * Otherwise the reusable read buffer is returned, which committed bytes are appended from, so response data never exposes unread bytes.
+             * \param p_size uint64_t
+             * \return std::span< uint8_t >
+             */
+        [[nodiscard]] auto responseBuffer(uint64_t p_size) -> std::span< uint8_t >;
+
+        /**
+             * \brief Adds first p_size bytes of the buffer returned by responseBuffer to response data
+             * \param p_size uint64_t
+             */
+        void commitResponseData(uint64_t p_size);
+
         /**
              * \brief Sets current request status
              * \param p_status Status
@@ -847,13 +971,21 @@ namespace tristan::network {
         std::vector< std::function< void(std::error_code) > > m_failed_with_error_code_callback_functors;
         std::vector< std::function< void(const std::string&, std::error_code) > > m_failed_with_id_and_error_code_callback_functors;
         std::vector< uint8_t > m_request_data;
+        std::vector< uint8_t > m_read_buffer;
         std::error_code m_error;
         std::shared_ptr< NetworkResponse > m_response;
+        std::shared_ptr< NetworkRequestBase > m_next_in_queue;
 
-        std::chrono::seconds m_timeout;
+        std::chrono::milliseconds m_connect_timeout;
+        std::chrono::milliseconds m_first_byte_timeout;
+        std::chrono::milliseconds m_idle_timeout;
+        std::chrono::milliseconds m_total_timeout;
+        std::chrono::steady_clock::time_point m_enqueued_at;
 
         uint64_t m_bytes_to_read;
         uint64_t m_bytes_read;
+        uint16_t m_read_buffer_size;
+        uint16_t m_write_buffer_size;
         std::unique_ptr< std::ofstream > m_output_file;
 
         Status m_status;
@@ -861,6 +993,7 @@ namespace tristan::network {
         std::atomic< bool > m_paused;
         std::atomic< bool > m_canceled;
         bool m_output_to_file;
+        bool m_segmented_response_storage;
         bool m_ssl;
     };
 
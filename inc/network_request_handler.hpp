@@ -3,17 +3,17 @@
 
 #include "tcp_request.hpp"
 
-#include <set>
 #include <list>
 #include <memory>
 #include <utility>
 #include <variant>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <functional>
 #include <stdexcept>
-#include <ranges>
+#include <chrono>
 
 namespace tristan::log {
     class Log;
@@ -23,8 +23,41 @@ namespace tristan::network {
 
     namespace private_ {
         class AsyncRequestHandler;
+        class RequestScheduler;
+        class AdmissionController;
+        template < class Type > class MpscQueue;
     }  // namespace private_
 
+    /**
+     * \enum AsyncRequestsDistribution
+     * \brief Defines how requests are assigned to async request handlers.
+     */
+    enum class AsyncRequestsDistribution : uint8_t {
+        /**
+         * \brief All requests to the same host are processed by the same handler.
+         */
+        HOST_HASH,
+        /**
+         * \brief Request is assigned to the handler which has the least number of unfinished requests.
+         */
+        LEAST_LOAD
+    };
+
+    /**
+     * \enum SchedulingPolicy
+     * \brief Defines the order in which pending requests of different priorities are dispatched.
+     */
+    enum class SchedulingPolicy : uint8_t {
+        /**
+         * \brief Request of lower priority is dispatched only when there are no requests of higher priority.
+         */
+        STRICT,
+        /**
+         * \brief Priorities are served in turns according to their weights.
+         */
+        WEIGHTED_FAIR
+    };
+
        //    using SuppoertedRequestTypes = std::variant< std::shared_ptr< TcpRequest >, std::shared_ptr< HttpRequest > >;
 
     /**
@@ -34,7 +67,7 @@ namespace tristan::network {
      */
     class NetworkRequestsHandler {
 
-        NetworkRequestsHandler() = default;
+        NetworkRequestsHandler();
 
         static auto instance() -> NetworkRequestsHandler&;
 
@@ -56,11 +89,125 @@ namespace tristan::network {
         static void setLogger(std::unique_ptr< tristan::log::Log >&& p_log);
 
         /**
-         * \brief Sets simultaneous requests limit which by default is 5.
+         * \brief Sets simultaneous requests limit which by default is 50. Zero means no limit.
+         * Requests over the limit stay queued and are dispatched as soon as one of active requests finishes, fails, is paused or canceled.
          * \param p_limit uint8_t.
          */
         static void setActiveDownloadsLimit(uint8_t p_limit);
 
+        /**
+         * \brief Sets simultaneous requests limit per host which by default is 6. Zero means no limit.
+         * \param p_limit uint8_t.
+         */
+        static void setActiveDownloadsPerHostLimit(uint8_t p_limit);
+
+        /**
+         * \brief Sets number of idle keep-alive HTTP connections kept per origin which by default is 6. Zero disables connection reuse.
+         * \param p_count uint8_t.
+         */
+        static void setMaxIdleConnectionsPerHost(uint8_t p_count);
+
+        /**
+         * \brief Sets time after which idle keep-alive HTTP connection is closed. Default value is 30 seconds.
+         * Keep-Alive timeout advertised by the server takes precedence if it is shorter.
+         * \param p_time_out std::chrono::milliseconds
+         */
+        static void setIdleConnectionTimeOut(std::chrono::milliseconds p_time_out);
+
+        /**
+         * \brief Sets number of TLS sessions kept for resumption of following handshakes. Default value is 256. Zero disables resumption.
+         * \param p_capacity uint16_t.
+         */
+        static void setTlsSessionCacheSize(uint16_t p_capacity);
+
+        /**
+         * \brief Sets delay after which connection to the next address of the host is attempted while previous attempts are still in progress.
+         * Default value is 250 ms as recommended by RFC 8305.
+         * \param p_delay std::chrono::milliseconds
+         */
+        static void setConnectionAttemptDelay(std::chrono::milliseconds p_delay);
+
+        /**
+         * \brief Sets maximum number of bytes which are read from socket at once by both sync and async handlers. Default value is 65535.
+         * Requests may override the value with NetworkRequestBase::setReadBufferSize.
+         * \param p_size uint16_t
+         */
+        static void setReadBufferSize(uint16_t p_size);
+
+        /**
+         * \brief Sets maximum number of bytes which are written to socket at once by both sync and async handlers. Default value is 65535.
+         * Requests may override the value with NetworkRequestBase::setWriteBufferSize.
+         * \param p_size uint16_t
+         */
+        static void setWriteBufferSize(uint16_t p_size);
+
+        /**
+         * \brief Sets maximum number of GET requests to the same origin which are written on one connection before their responses are read.
+         * Default value is 0 which disables pipelining. Requests left unanswered when the server closes the connection are resent on their own connections.
+         * \param p_depth uint8_t
+         * \note Should be invoked before run().
+         */
+        static void setHttpPipeliningDepth(uint8_t p_depth);
+
+        /**
+         * \brief Sets number of async request handlers each of which runs in its own thread.
+         * Default value is 0 which means the number of hardware threads.
+         * \param p_count uint8_t
+         * \note Should be invoked before run().
+         */
+        static void setAsyncHandlersCount(uint8_t p_count);
+
+        /**
+         * \brief Sets how requests are assigned to async request handlers. Default value is AsyncRequestsDistribution::HOST_HASH.
+         * \param p_distribution AsyncRequestsDistribution
+         */
+        static void setAsyncRequestsDistribution(AsyncRequestsDistribution p_distribution);
+
+        /**
+         * \brief Enables stealing of ready requests between async request handlers. Default value is false.
+         * Stealing balances CPU load between handlers, but requests to the same host may be resumed by different threads.
+         * \param p_enabled bool
+         * \note Should be invoked before run().
+         */
+        static void setWorkStealing(bool p_enabled);
+
+        /**
+         * \brief Sets number of workers which process requests with Priority::OUT_OF_QUEUE. Default value is 8.
+         * \param p_count uint8_t
+         * \note Should be invoked before run().
+         */
+        static void setOutOfQueueWorkersCount(uint8_t p_count);
+
+        /**
+         * \brief Sets scheduling policy of pending requests. Default value is SchedulingPolicy::STRICT.
+         * \param p_policy SchedulingPolicy
+         */
+        static void setSchedulingPolicy(SchedulingPolicy p_policy);
+
+        /**
+         * \brief Sets number of requests dispatched from each priority per round with SchedulingPolicy::WEIGHTED_FAIR.
+         * Default values are 4, 2 and 1.
+         * \param p_high uint8_t
+         * \param p_normal uint8_t
+         * \param p_low uint8_t
+         */
+        static void setPriorityWeights(uint8_t p_high, uint8_t p_normal, uint8_t p_low);
+
+        /**
+         * \brief Sets time after which pending request with Priority::LOW is dispatched ahead of other priorities.
+         * Default value is 10 seconds. Zero disables starvation protection.
+         * \param p_threshold std::chrono::milliseconds
+         */
+        static void setLowPriorityAgingThreshold(std::chrono::milliseconds p_threshold);
+
+        /**
+         * \brief Sets number of requests with Priority::OUT_OF_QUEUE which may wait for a free worker. Default value is 64.
+         * When the limit is reached the handler loop blocks until one of the workers takes the next request.
+         * \param p_limit uint16_t
+         * \note Should be invoked before run().
+         */
+        static void setOutOfQueueRequestsLimit(uint16_t p_limit);
+
         /**
          * \brief Starts the handler loop.
          * \note This function if blocking and should be ran in a separate thread.
@@ -113,7 +260,11 @@ namespace tristan::network {
          */
         static void addRequest(std::shared_ptr< NetworkRequestBase >&& p_request);
 
-        static auto pendingRequests() -> std::ranges::ref_view< std::multiset< std::shared_ptr< NetworkRequestBase > > >;
+        /**
+         * \brief Returns copy of requests which wait to be dispatched, from the highest priority to the lowest.
+         * \return std::vector< std::shared_ptr< NetworkRequestBase > >
+         */
+        static auto pendingRequests() -> std::vector< std::shared_ptr< NetworkRequestBase > >;
 
         /**
          * \brief Returns list of currently active requests.
@@ -129,30 +280,50 @@ namespace tristan::network {
 
     protected:
     private:
-        std::mutex m_nr_multiset_lock;
+        std::mutex m_nr_queue_lock;
         std::mutex m_error_nr_lock;
         std::mutex m_active_nr_lock;
 
-//        struct Compare {
-//            bool operator()(const std::shared_ptr< NetworkRequestBase >& p_left, const std::shared_ptr< NetworkRequestBase >& p_right) const {
-//                return p_left < p_right;
-//            }
-//        };
+        /**
+         * \brief Wakes the dispatcher loop when request is added or when the state of the handler is changed.
+         */
+        std::condition_variable m_requests_cv;
 
-        std::multiset< std::shared_ptr< NetworkRequestBase > > m_requests;
+        std::unique_ptr< private_::RequestScheduler > m_requests;
+
+        std::unique_ptr< private_::AdmissionController > m_admission_controller;
+
+        /**
+         * \brief Lock-free intake of addRequest(). Drained into m_requests by the dispatcher loop.
+         * When the ring is full requests are inserted into m_requests under the lock.
+         */
+        std::unique_ptr< private_::MpscQueue< std::shared_ptr< NetworkRequestBase > > > m_submitted_requests;
 
         std::list< std::shared_ptr< NetworkRequestBase > > m_error_requests;
         std::list< std::shared_ptr< NetworkRequestBase > > m_active_requests;
 
         std::vector< std::function< void() > > m_notify_when_exit_functions;
 
-        std::unique_ptr< private_::AsyncRequestHandler > m_async_tcp_requests_handler;
+        std::vector< std::unique_ptr< private_::AsyncRequestHandler > > m_async_requests_handlers;
         std::unique_ptr< private_::SyncNetworkRequestHandlerImpl > m_request_handler;
-        std::thread m_async_request_handler_thread;
+        std::vector< std::thread > m_async_request_handler_threads;
 
         std::atomic< bool > m_working;
         std::atomic< bool > m_paused;
 
+        /**
+         * \brief Set by the dispatcher before it checks for requests, so producers notify it only when it may sleep.
+         */
+        std::atomic< bool > m_dispatcher_waiting;
+
+        std::atomic< AsyncRequestsDistribution > m_async_requests_distribution;
+
+        uint16_t m_out_of_queue_requests_limit;
+        uint8_t m_out_of_queue_workers_count;
+        uint8_t m_async_handlers_count;
+        uint8_t m_http_pipelining_depth;
+        bool m_work_stealing;
+
         void _run();
 
         void _pause();
@@ -163,6 +334,19 @@ namespace tristan::network {
 
         void _addRequest(std::shared_ptr< NetworkRequestBase >&& request);
 
+        void _drainSubmittedRequests();
+
+        /**
+         * \brief Returns request which may be dispatched now. Should be invoked with m_nr_queue_lock held.
+         * \param p_admitted bool& is set to true if request took a slot of admission controller.
+         * \return std::shared_ptr< NetworkRequestBase > or nullptr if popped request was parked.
+         */
+        [[nodiscard]] auto _nextRequest(bool& p_admitted) -> std::shared_ptr< NetworkRequestBase >;
+
+        void _releaseAdmission(const std::string& p_host);
+
+        [[nodiscard]] auto _selectAsyncRequestHandler(const std::shared_ptr< NetworkRequestBase >& p_request) const -> private_::AsyncRequestHandler&;
+
         template < class Object > void _notifyWhenExit(std::weak_ptr< Object > p_object, void (Object::*p_function)());
 
         template < class Object > void _notifyWhenExit(Object* p_object, void (Object::*p_function)());
@@ -1,6 +1,8 @@
 #ifndef NETWORK_RESPONSE_HPP
 #define NETWORK_RESPONSE_HPP
 
+#include "segmented_buffer.hpp"
+
 #include <string>
 #include <vector>
 #include <memory>
@@ -32,15 +34,24 @@ namespace tristan::network {
         /**
          * \brief Provide access to data received from the remote.
          * \return const std::vector<uint8_t>&.
+         * \note If response was stored in segments the data is copied into the new contiguous vector on each invocation.
          */
         [[nodiscard]] auto data() const -> std::shared_ptr< std::vector< uint8_t > >;
 
+        /**
+         * \brief Provide access to data received from the remote if segmented storage was requested.
+         * \return std::shared_ptr< SegmentedBuffer > which is nullptr if response data is stored contiguously.
+         */
+        [[nodiscard]] auto segmentedData() const -> std::shared_ptr< SegmentedBuffer >;
+
     protected:
         explicit NetworkResponse(std::string&& p_uuid);
 
         std::string m_uuid;
 
         std::shared_ptr< std::vector< uint8_t > > m_response_data;
+
+        std::shared_ptr< SegmentedBuffer > m_segmented_response_data;
     };
 
 }  // namespace tristan::network
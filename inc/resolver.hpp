@@ -0,0 +1,178 @@
+#ifndef RESOLVER_HPP
+#define RESOLVER_HPP
+
+#include <string>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <chrono>
+#include <functional>
+#include <system_error>
+
+struct IP {
+    std::string as_string;
+    /**
+     * \brief IPv4 address in network byte order. Is 0 for IPv6 address.
+     */
+    uint32_t as_int = 0;
+    /**
+     * \brief IPv6 address in network byte order. Valid only if is_ipv6 is true.
+     */
+    std::array< uint8_t, 16 > as_ipv6{};
+    bool is_ipv6 = false;
+};
+
+namespace tristan::network {
+
+    namespace private_ {
+        class ThreadPool;
+    }  // namespace private_
+
+    /**
+     * \struct ResolvedHost
+     * \brief Result of host name resolution.
+     */
+    struct ResolvedHost {
+        std::vector< IP > addresses;
+        std::error_code error;
+    };
+
+    /**
+     * \class Resolver
+     * \brief Resolves host names on background workers and caches the results.
+     * Host names are resolved by the system resolver which honours /etc/hosts and nsswitch.conf, DNS is queried directly only if it failed.
+     * Successful lookups are cached for the default time to live or for the time to live of DNS records, failed ones for the negative time to live.
+     * Concurrent lookups of the same host share one query.
+     * \Threadsafe Yes
+     */
+    class Resolver {
+
+        Resolver();
+
+        static auto instance() -> Resolver&;
+
+    public:
+        Resolver(const Resolver& p_other) = delete;
+        Resolver(Resolver&& p_other) = delete;
+
+        Resolver& operator=(const Resolver& p_other) = delete;
+        Resolver& operator=(Resolver&& p_other) = delete;
+
+        ~Resolver();
+
+        /**
+         * \brief Starts resolution of p_host unless the result is cached or the lookup is already in flight.
+         * \param p_host const std::string&
+         * \return std::shared_future< ResolvedHost >
+         */
+        [[nodiscard]] static auto resolveAsync(const std::string& p_host) -> std::shared_future< ResolvedHost >;
+
+        /**
+         * \brief Resolves p_host. Blocks only if the result is not cached.
+         * \param p_host const std::string&
+         * \return ResolvedHost
+         */
+        [[nodiscard]] static auto resolve(const std::string& p_host) -> ResolvedHost;
+
+        /**
+         * \brief Invokes p_callback from the resolver thread once the lookup which p_result belongs to is finished.
+         * \param p_host const std::string&
+         * \param p_result const std::shared_future< ResolvedHost >& returned by resolveAsync(p_host).
+         * \param p_callback std::function< void() >
+         * \return false if p_result is already ready, in which case p_callback is not invoked.
+         */
+        [[nodiscard]] static auto notifyWhenResolved(const std::string& p_host,
+                                                     const std::shared_future< ResolvedHost >& p_result,
+                                                     std::function< void() > p_callback) -> bool;
+
+        /**
+         * \brief Adds address which p_host is resolved to without DNS query. Entries never expire.
+         * \param p_host const std::string&
+         * \param p_ip const std::string& IPv4 or IPv6 address.
+         */
+        static void addHostEntry(const std::string& p_host, const std::string& p_ip);
+
+        /**
+         * \brief Removes all addresses added to p_host by addHostEntry().
+         * \param p_host const std::string&
+         */
+        static void removeHostEntry(const std::string& p_host);
+
+        /**
+         * \brief Sets time to live of successful lookup which was answered by the system resolver. Default value is 60 seconds.
+         * \param p_ttl std::chrono::seconds
+         */
+        static void setDefaultTimeToLive(std::chrono::seconds p_ttl);
+
+        /**
+         * \brief Sets time to live of failed lookup. Default value is 5 seconds. Zero disables negative caching.
+         * \param p_ttl std::chrono::seconds
+         */
+        static void setNegativeTimeToLive(std::chrono::seconds p_ttl);
+
+        /**
+         * \brief Removes all cached results. Lookups in flight are not affected.
+         */
+        static void clearCache();
+
+    protected:
+    private:
+        struct CachedHost {
+            std::shared_future< ResolvedHost > result;
+            /**
+             * \brief Time point when the result expires. Is max() while lookup is in flight.
+             */
+            std::chrono::steady_clock::time_point expiry;
+        };
+
+        std::mutex m_lock;
+
+        std::unordered_map< std::string, CachedHost > m_cache;
+
+        std::unordered_map< std::string, std::vector< IP > > m_hosts_table;
+
+        /**
+         * \brief Callbacks waiting for lookups in flight.
+         */
+        std::unordered_map< std::string, std::vector< std::function< void() > > > m_waiters;
+
+        std::unique_ptr< private_::ThreadPool > m_workers;
+
+        std::chrono::seconds m_default_ttl;
+
+        std::chrono::seconds m_negative_ttl;
+
+        [[nodiscard]] auto _resolveAsync(const std::string& p_host) -> std::shared_future< ResolvedHost >;
+
+        void _resolve(const std::string& p_host, const std::shared_ptr< std::promise< ResolvedHost > >& p_result);
+
+        /**
+         * \brief Sets result of the lookup and invokes callbacks waiting for it.
+         * \param p_host const std::string&
+         * \param p_result const std::shared_ptr< std::promise< ResolvedHost > >&
+         * \param p_resolved_host ResolvedHost&&
+         */
+        void _complete(const std::string& p_host, const std::shared_ptr< std::promise< ResolvedHost > >& p_result, ResolvedHost&& p_resolved_host);
+
+        /**
+         * \brief Queries DNS for A and AAAA records. IPv4 addresses are placed first. Is used only if the system resolver failed.
+         * \param p_host const std::string&
+         * \param p_ttl std::chrono::seconds& is set to the lowest time to live of the answers.
+         * \return ResolvedHost with empty addresses if DNS did not answer.
+         */
+        [[nodiscard]] static auto _queryDns(const std::string& p_host, std::chrono::seconds& p_ttl) -> ResolvedHost;
+
+        /**
+         * \brief Resolves host with getaddrinfo which also consults /etc/hosts and other sources configured in nsswitch.conf.
+         * \param p_host const std::string&
+         * \return ResolvedHost
+         */
+        [[nodiscard]] static auto _getAddressInfo(const std::string& p_host) -> ResolvedHost;
+    };
+
+}  // namespace tristan::network
+
+#endif  //RESOLVER_HPP
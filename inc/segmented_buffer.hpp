@@ -0,0 +1,123 @@
+#ifndef SEGMENTED_BUFFER_HPP
+#define SEGMENTED_BUFFER_HPP
+
+#include <vector>
+#include <memory>
+#include <span>
+#include <cstdint>
+
+#include <sys/uio.h>
+
+namespace tristan::network {
+
+    /**
+     * \class SegmentedBuffer
+     * \brief Stores data in the chain of fixed size segments which are taken from and returned to the process-wide pool.
+     * Appending never moves data which was already stored, so the buffer grows in O(n) without reallocations.
+     * \Threadsafe No
+     */
+    class SegmentedBuffer {
+    public:
+        /**
+         * \brief Size of each segment in bytes.
+         */
+        static constexpr uint64_t segment_size = 64 * 1024;
+
+        /**
+         * \brief Default constructor
+         */
+        SegmentedBuffer() = default;
+
+        SegmentedBuffer(const SegmentedBuffer& p_other) = delete;
+
+        /**
+         * \brief Move constructor
+         * \param p_other SegmentedBuffer&&
+         */
+        SegmentedBuffer(SegmentedBuffer&& p_other) noexcept = default;
+
+        SegmentedBuffer& operator=(const SegmentedBuffer& p_other) = delete;
+
+        /**
+         * \brief Move assignment operator
+         * \param p_other SegmentedBuffer&&
+         * \return SegmentedBuffer&
+         */
+        SegmentedBuffer& operator=(SegmentedBuffer&& p_other) noexcept;
+
+        /**
+         * \brief Destructor. Returns segments to the pool.
+         */
+        ~SegmentedBuffer();
+
+        /**
+         * \brief Sets maximum number of free segments which are kept in the process-wide pool. Default value is 256.
+         * \param p_count uint32_t
+         */
+        static void setPoolCapacity(uint32_t p_count);
+
+        /**
+         * \brief Appends data to the end of the buffer.
+         * \param p_data std::span< const uint8_t >
+         */
+        void append(std::span< const uint8_t > p_data);
+
+        /**
+         * \brief Returns free space at the end of the buffer which may be written directly. New segment is added if the last one is full.
+         * \param p_max_size uint64_t
+         * \return std::span< uint8_t > which size is not greater than p_max_size and the space left in the last segment.
+         * \note Written bytes become a part of the buffer only after commit is invoked.
+         */
+        [[nodiscard]] auto writableTail(uint64_t p_max_size) -> std::span< uint8_t >;
+
+        /**
+         * \brief Adds p_size bytes written into the span returned by writableTail to the buffer.
+         * \param p_size uint64_t
+         */
+        void commit(uint64_t p_size);
+
+        /**
+         * \brief Removes all data and returns segments to the pool.
+         */
+        void clear();
+
+        /**
+         * \brief Returns number of bytes stored.
+         * \return uint64_t
+         */
+        [[nodiscard]] auto size() const noexcept -> uint64_t;
+
+        /**
+         * \brief Returns true if buffer stores no data.
+         * \return bool
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool;
+
+        /**
+         * \brief Returns stored data as the sequence of spans.
+         * \return std::vector< std::span< const uint8_t > >
+         */
+        [[nodiscard]] auto segments() const -> std::vector< std::span< const uint8_t > >;
+
+        /**
+         * \brief Returns stored data as the sequence of iovec which may be passed to writev.
+         * \return std::vector< iovec >
+         */
+        [[nodiscard]] auto iovecs() const -> std::vector< iovec >;
+
+        /**
+         * \brief Copies stored data into contiguous vector.
+         * \return std::vector< uint8_t >
+         */
+        [[nodiscard]] auto contiguous() const -> std::vector< uint8_t >;
+
+    protected:
+    private:
+        std::vector< std::unique_ptr< uint8_t[] > > m_segments;
+
+        uint64_t m_last_segment_size = 0;
+    };
+
+}  // namespace tristan::network
+
+#endif  //SEGMENTED_BUFFER_HPP
@@ -2,14 +2,12 @@
 #define URL_HPP
 
 #include "network_error.hpp"
+#include "resolver.hpp"
 
 #include <string>
 #include <vector>
-
-struct IP {
-    std::string as_string;
-    uint32_t as_int;
-};
+#include <future>
+#include <functional>
 
 namespace tristan::network {
     /**
@@ -27,7 +25,8 @@ namespace tristan::network {
         /**
          * \brief Overloaded constructor.
          * Parses passed uri string representation into values. If parsing was successful
-         * \param m_valid is set to true. URI representation must conform to the following format:
+         * \param m_valid is set to true. Host name is resolved in background, see hostResolved().
+         * URI representation must conform to the following format:
          * \par URI = scheme ":" ["//" authority] path ["?" query] ["#" fragment]
          * \param p_url const std::string& which represents and uri
          */
@@ -47,6 +46,7 @@ namespace tristan::network {
 
         /**
          * \brief Sets host, user name and password which are parts of userinfo part of authority.
+         * Host name is resolved in background, see hostResolved().
          * \param p_host const std::string&
          * \param p_user_name const std::string&. Default value is an empty string.
          * \param p_user_password const std::string&. Default value is an empty string.
@@ -113,14 +113,29 @@ namespace tristan::network {
          */
         [[nodiscard]] auto host() const noexcept -> const std::string&;
 
+        /**
+         * \brief Returns true if host name resolution is finished or was not needed.
+         * \return bool
+         */
+        [[nodiscard]] auto hostResolved() const -> bool;
+
+        /**
+         * \brief Invokes p_callback from the resolver thread once host name resolution is finished.
+         * \param p_callback std::function< void() >
+         * \return false if resolution is already finished or was not needed, in which case p_callback is not invoked.
+         */
+        [[nodiscard]] auto notifyWhenHostResolved(std::function< void() > p_callback) const -> bool;
+
         /**
          * \brief Returns host in form of ip address
+         * \note Blocks until host name is resolved.
          * \return const std::string&
          */
         [[nodiscard]] auto hostIP() const noexcept -> IP;
 
         /**
          * \brief Returns list of host ip addresses
+         * \note Blocks until host name is resolved.
          * \return const std::vector<std::string>&
          */
         [[nodiscard]] auto hostIPList() const noexcept -> const std::vector< IP >&;
@@ -170,6 +185,7 @@ namespace tristan::network {
 
         /**
          * \brief Check if URI is valid. Should be used in case of overloaded constructor.
+         * \note Host name resolution failure is reported only after it is finished, see hostResolved().
          * \return True is valid and false otherwise.
          */
         [[nodiscard]] auto isValid() const noexcept -> bool;
@@ -193,6 +209,11 @@ namespace tristan::network {
 
         std::vector< IP > m_host_ip;
 
+        /**
+         * \brief Result of host name resolution. Is not valid if host was set as ip address or after it was merged into m_host_ip.
+         */
+        std::shared_future< ResolvedHost > m_resolved_host;
+
         std::error_code m_error;
 
         uint16_t m_port_local_byte_order;
@@ -201,6 +222,13 @@ namespace tristan::network {
         bool m_valid;
 
         void _resolveHost();
+
+        /**
+         * \brief Waits for host name resolution and moves its result into m_host_ip.
+         */
+        void _takeResolvedHost();
+
+        [[nodiscard]] auto _resolutionError() const noexcept -> std::error_code;
     };
 
 }  // namespace tristan::network
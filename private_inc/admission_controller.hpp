@@ -0,0 +1,125 @@
+#ifndef ADMISSION_CONTROLLER_HPP
+#define ADMISSION_CONTROLLER_HPP
+
+#include "network_request_base.hpp"
+
+#include <memory>
+#include <string>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class AdmissionController
+     * \brief Limits number of simultaneously processed requests globally and per host.
+     * \details Request which exceeds the per host limit is parked in the wait queue of its host
+     * and becomes admissible as soon as a request to the same host releases its slot.
+     * \Threadsafe Yes
+     */
+    class AdmissionController {
+    public:
+        AdmissionController();
+
+        AdmissionController(const AdmissionController& p_other) = delete;
+        AdmissionController(AdmissionController&& p_other) = delete;
+
+        AdmissionController& operator=(const AdmissionController& p_other) = delete;
+        AdmissionController& operator=(AdmissionController&& p_other) = delete;
+
+        ~AdmissionController() = default;
+
+        /**
+         * \brief Returns key which is used to account requests per host.
+         * \param p_request const NetworkRequestBase&
+         * \return std::string
+         */
+        [[nodiscard]] static auto hostKey(const NetworkRequestBase& p_request) -> std::string;
+
+        /**
+         * \brief Sets number of requests which are processed simultaneously. Zero means no limit.
+         * \param p_limit uint16_t
+         */
+        void setGlobalLimit(uint16_t p_limit);
+
+        /**
+         * \brief Sets number of requests to the same host which are processed simultaneously. Zero means no limit.
+         * \param p_limit uint16_t
+         */
+        void setHostLimit(uint16_t p_limit);
+
+        /**
+         * \brief Returns whether global limit allows one more request.
+         * \return bool
+         */
+        [[nodiscard]] auto hasFreeSlot() -> bool;
+
+        /**
+         * \brief Returns whether any parked request may be admitted.
+         * \return bool
+         */
+        [[nodiscard]] auto hasAdmissible() -> bool;
+
+        /**
+         * \brief Admits parked request which slot was freed.
+         * \return std::shared_ptr< NetworkRequestBase > or nullptr if there is no such request.
+         */
+        [[nodiscard]] auto popAdmissible() -> std::shared_ptr< NetworkRequestBase >;
+
+        /**
+         * \brief Tries to take a slot for p_request.
+         * \param p_request std::shared_ptr< NetworkRequestBase >&. If global or host limit is reached request is moved to the host wait queue.
+         * \return true if slot was taken, false if request was parked.
+         */
+        [[nodiscard]] auto tryAdmit(std::shared_ptr< NetworkRequestBase >& p_request) -> bool;
+
+        /**
+         * \brief Frees slot which was taken by request to p_host.
+         * \param p_host const std::string&
+         */
+        void release(const std::string& p_host);
+
+        /**
+         * \brief Returns copy of parked requests.
+         * \return std::vector< std::shared_ptr< NetworkRequestBase > >
+         */
+        [[nodiscard]] auto parkedRequests() -> std::vector< std::shared_ptr< NetworkRequestBase > >;
+
+    protected:
+    private:
+        struct Host {
+            std::deque< std::shared_ptr< NetworkRequestBase > > m_waiting_requests;
+            uint16_t m_active_requests = 0;
+        };
+
+        std::mutex m_lock;
+
+        std::unordered_map< std::string, Host > m_hosts;
+
+        /**
+         * \brief Hosts which have parked requests and may admit one of them once global limit allows.
+         */
+        std::deque< std::string > m_ready_hosts;
+
+        uint16_t m_global_limit;
+
+        uint16_t m_host_limit;
+
+        uint16_t m_active_requests;
+
+        [[nodiscard]] auto _hasFreeSlot() const -> bool;
+
+        [[nodiscard]] auto _hostHasFreeSlot(const Host& p_host) const -> bool;
+
+        /**
+         * \brief Drops ready hosts which can not admit a request. Should be invoked with m_lock held.
+         * \return Host* which can admit a request or nullptr.
+         */
+        [[nodiscard]] auto _frontReadyHost() -> Host*;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //ADMISSION_CONTROLLER_HPP
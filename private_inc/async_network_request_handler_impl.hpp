@@ -2,24 +2,75 @@
 #define ASYNC_NETWORK_REQUEST_HANDLER_IMPL_HPP
 
 #include "network_request_handler_impl.hpp"
+#include "reactor.hpp"
+#include "connection_pool.hpp"
+#include "http_pipeline.hpp"
 
 #include <resumable_coroutine.hpp>
 
+#include <map>
+#include <tuple>
+#include <string>
+#include <mutex>
+#include <functional>
+
 namespace tristan::network::private_ {
 
     class AsyncNetworkRequestHandlerImpl : public NetworkRequestHandlerImpl {
     public:
         AsyncNetworkRequestHandlerImpl();
         ~AsyncNetworkRequestHandlerImpl() override;
-        auto handleRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request) -> tristan::ResumableCoroutine;
+        /**
+         * \brief Creates coroutine which processes the request.
+         * \param p_network_request std::shared_ptr< NetworkRequestBase >&&
+         * \param p_pipelining_allowed bool. If false GET request is never appended to HTTP pipeline.
+         * \return tristan::ResumableCoroutine
+         */
+        auto handleRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request, bool p_pipelining_allowed = true) -> tristan::ResumableCoroutine;
+
+        /**
+         * \brief Sets maximum number of GET requests to the same origin which are written on one connection before their responses are read.
+         * Default value is 0 which disables pipelining.
+         * \param p_depth uint8_t
+         */
+        void setHttpPipeliningDepth(uint8_t p_depth);
+
+        /**
+         * \brief Sets function which resubmits requests left unanswered when pipelined connection was closed.
+         * \param p_function std::function< void(std::shared_ptr< NetworkRequestBase >&&) >&&
+         */
+        void setRequeueFunction(std::function< void(std::shared_ptr< NetworkRequestBase >&&) >&& p_function);
 
     protected:
         auto handleTcpRequest(std::shared_ptr< tristan::network::TcpRequest > p_tcp_request) -> tristan::ResumableCoroutine;
-        auto handleHTTPRequest(std::shared_ptr< tristan::network::HttpRequest > p_http_request) -> tristan::ResumableCoroutine;
+        /**
+         * \brief Processes HTTP request. If p_pipeline is not nullptr processes all requests appended to it on the same connection.
+         * \param p_http_request std::shared_ptr< tristan::network::HttpRequest >
+         * \param p_pipeline std::shared_ptr< HttpPipeline >
+         * \return tristan::ResumableCoroutine
+         */
+        auto handleHTTPRequest(std::shared_ptr< tristan::network::HttpRequest > p_http_request, std::shared_ptr< HttpPipeline > p_pipeline)
+            -> tristan::ResumableCoroutine;
+        auto handlePipelinedHttpRequest(std::shared_ptr< tristan::network::HttpRequest > p_http_request) -> tristan::ResumableCoroutine;
         auto handleUnimplementedRequest(std::shared_ptr< tristan::network::NetworkRequestBase > p_network_request) -> tristan::ResumableCoroutine;
 
     private:
-        const uint8_t m_max_frame_size = std::numeric_limits<uint8_t>::max();
+        std::mutex m_http_pipelines_lock;
+
+        using HttpPipelineKey = std::tuple< std::string, uint16_t, bool >;
+
+        std::map< HttpPipelineKey, std::shared_ptr< HttpPipeline > > m_http_pipelines;
+
+        std::function< void(std::shared_ptr< NetworkRequestBase >&&) > m_requeue_function;
+
+        uint8_t m_http_pipelining_depth;
+
+        /**
+         * \brief Closes p_pipeline, removes it from pipelines map and resubmits requests which were neither answered nor failed.
+         * \param p_pipeline_key const HttpPipelineKey&
+         * \param p_pipeline const std::shared_ptr< HttpPipeline >&
+         */
+        void _abortHttpPipeline(const HttpPipelineKey& p_pipeline_key, const std::shared_ptr< HttpPipeline >& p_pipeline);
     };
 
 }  // namespace tristan::network::private_
@@ -3,18 +3,22 @@
 
 #include "tcp_request.hpp"
 #include "http_request.hpp"
-
-#include <resumable_coroutine.hpp>
+#include "async_task.hpp"
+#include "work_stealing_deque.hpp"
+#include "mpsc_queue.hpp"
 
 #include <memory>
 #include <list>
+#include <vector>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 
 namespace tristan::network::private_ {
 
 //    namespace private_ {
         class AsyncNetworkRequestHandlerImpl;
+        class Reactor;
 //    } //End of private_ namespace
 
     class AsyncRequestHandler {
@@ -32,21 +36,105 @@ namespace tristan::network::private_ {
         void run();
         void addRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request);
 
-        void setMaxDownloadsCount(uint8_t p_count);
+        /**
+         * \brief Sets handlers which ready requests may be stolen from when this handler runs out of work.
+         * Empty vector disables work stealing.
+         * \param p_siblings std::vector< AsyncRequestHandler* >
+         * \note Should be invoked before run().
+         */
+        void setSiblings(std::vector< AsyncRequestHandler* > p_siblings);
+
+        /**
+         * \brief Sets maximum number of GET requests to the same origin which are written on one connection before their responses are read.
+         * Values below 2 disable pipelining.
+         * \param p_depth uint8_t
+         * \note Should be invoked before run().
+         */
+        void setHttpPipeliningDepth(uint8_t p_depth);
         void stop();
 
+        /**
+         * \brief Returns number of requests which were added and are not finished yet.
+         * \return size_t
+         */
+        [[nodiscard]] auto load() const noexcept -> size_t;
+
     protected:
     private:
+        std::unique_ptr< private_::Reactor > m_reactor;
 
-        std::mutex m_processed_requests_lock;
+        std::unique_ptr<private_::AsyncNetworkRequestHandlerImpl> m_request_handler;
 
-        std::list< tristan::ResumableCoroutine > m_processed_requests;
+        /**
+         * \brief Lock-free intake of addRequest().
+         */
+        MpscQueue< std::unique_ptr< AsyncTask > > m_submitted_requests;
 
-        std::unique_ptr<private_::AsyncNetworkRequestHandlerImpl> m_request_handler;
+        std::mutex m_pending_requests_lock;
+
+        /**
+         * \brief Requests which did not fit into m_submitted_requests.
+         */
+        std::list< std::unique_ptr< AsyncTask > > m_pending_requests;
+
+        std::atomic< size_t > m_pending_requests_count;
+
+        std::list< std::unique_ptr< AsyncTask > > m_processed_requests;
+
+        /**
+         * \brief Requests which are ready to be resumed. Siblings steal from the top of the deque.
+         */
+        WorkStealingDeque< AsyncTask > m_ready_requests;
+
+        /**
+         * \brief Ready requests which did not fit into m_ready_requests. Never stolen.
+         */
+        std::vector< AsyncTask* > m_ready_requests_overflow;
+
+        /**
+         * \brief Requests returned by reactor. Reused between iterations to avoid allocations.
+         */
+        std::vector< AsyncTask* > m_polled_requests;
+
+        std::vector< AsyncRequestHandler* > m_siblings;
+
+        std::mutex m_finished_requests_lock;
+
+        /**
+         * \brief Requests owned by this handler which were finished by siblings.
+         */
+        std::vector< AsyncTask* > m_finished_requests;
 
-        uint8_t m_max_processed_requests_count;
+        std::atomic< size_t > m_requests_count;
+
+        size_t m_next_sibling;
 
         std::atomic< bool > m_working;
+
+        /**
+         * \brief Set while the handler is blocked in the reactor. Used to wake only siblings which have nothing to do.
+         */
+        std::atomic< bool > m_idle;
+
+        void _submit(std::shared_ptr< NetworkRequestBase >&& p_network_request, bool p_pipelining_allowed);
+
+        void _admitPendingRequests();
+
+        void _releaseFinishedRequests();
+
+        void _pushReady(AsyncTask* p_task);
+
+        [[nodiscard]] auto _popReady() -> AsyncTask*;
+
+        [[nodiscard]] auto _steal() -> AsyncTask*;
+
+        void _wakeIdleSibling();
+
+        void _resume(AsyncTask* p_task, std::vector< AsyncTask* >& p_yielded_tasks);
+
+        void _finish(AsyncTask* p_task);
+
+        void _retire(AsyncTask* p_task);
     };
 }  // namespace tristan::network
 
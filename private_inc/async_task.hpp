@@ -0,0 +1,52 @@
+#ifndef ASYNC_TASK_HPP
+#define ASYNC_TASK_HPP
+
+#include "timer_wheel.hpp"
+
+#include <resumable_coroutine.hpp>
+
+#include <list>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+namespace tristan::network::private_ {
+
+    class AsyncRequestHandler;
+
+    /**
+     * \struct AsyncTask
+     * \brief Holds coroutine which processes a request together with its scheduling state.
+     * \details Task is its own timer node, so waiting for a socket with a deadline does not allocate.
+     */
+    struct AsyncTask : public TimerWheel::Timer {
+        tristan::ResumableCoroutine m_coroutine;
+        /**
+         * \brief Position of the task in the owning list which is used for O(1) removal.
+         */
+        std::list< std::unique_ptr< AsyncTask > >::iterator m_position;
+        /**
+         * \brief Handler which owns the task. Differs from the handler which resumes the task if the task was stolen.
+         */
+        AsyncRequestHandler* m_owner;
+        std::chrono::steady_clock::time_point m_deadline;
+        /**
+         * \brief Descriptors the task waits for. Capacity is kept between waits to avoid allocations.
+         */
+        std::vector< int > m_fds;
+        bool m_waiting;
+        /**
+         * \brief Set when the task was resumed because its deadline passed before the socket became ready.
+         */
+        bool m_timed_out;
+
+        explicit AsyncTask(tristan::ResumableCoroutine&& coroutine_) :
+            m_coroutine(std::move(coroutine_)),
+            m_owner(nullptr),
+            m_waiting(false),
+            m_timed_out(false) { }
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //ASYNC_TASK_HPP
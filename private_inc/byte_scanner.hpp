@@ -0,0 +1,30 @@
+#ifndef BYTE_SCANNER_HPP
+#define BYTE_SCANNER_HPP
+
+#include <span>
+#include <cstdint>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \brief Returns pointer to the first occurrence of p_byte in [p_begin, p_end).
+     * Uses AVX2 or SSE2 if CPU supports it, the implementation is chosen at runtime on the first invocation.
+     * \param p_begin const uint8_t*
+     * \param p_end const uint8_t*
+     * \param p_byte uint8_t
+     * \return const uint8_t* which is p_end if p_byte was not found.
+     */
+    [[nodiscard]] auto findByte(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t*;
+
+    /**
+     * \brief Returns pointer to the first occurrence of p_sequence in [p_begin, p_end).
+     * \param p_begin const uint8_t*
+     * \param p_end const uint8_t*
+     * \param p_sequence std::span< const uint8_t >. Should not be empty.
+     * \return const uint8_t* which is p_end if p_sequence was not found.
+     */
+    [[nodiscard]] auto findSequence(const uint8_t* p_begin, const uint8_t* p_end, std::span< const uint8_t > p_sequence) noexcept -> const uint8_t*;
+
+}  // namespace tristan::network::private_
+
+#endif  //BYTE_SCANNER_HPP
@@ -0,0 +1,116 @@
+#ifndef CONNECTION_POOL_HPP
+#define CONNECTION_POOL_HPP
+
+#include "http_response.hpp"
+
+#include <inet_socket.hpp>
+
+#include <memory>
+#include <deque>
+#include <map>
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <optional>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class ConnectionPool
+     * \brief Keeps idle connected sockets so that following requests to the same origin skip connect and TLS handshake.
+     * \Threadsafe Yes
+     */
+    class ConnectionPool {
+    public:
+        /**
+         * \struct Key
+         * \brief Identifies origin of the connection. Host name is used since connection may be established to any of the host addresses.
+         */
+        struct Key {
+            std::string m_host;
+            uint16_t m_port;
+            bool m_ssl;
+
+            friend auto operator<=>(const Key& p_left, const Key& p_right) = default;
+        };
+
+        ConnectionPool(const ConnectionPool& p_other) = delete;
+        ConnectionPool(ConnectionPool&& p_other) = delete;
+
+        ConnectionPool& operator=(const ConnectionPool& p_other) = delete;
+        ConnectionPool& operator=(ConnectionPool&& p_other) = delete;
+
+        ~ConnectionPool() = default;
+
+        static auto instance() -> ConnectionPool&;
+
+        /**
+         * \brief Sets maximum number of idle connections per origin. Default value is 6. Zero disables pooling.
+         * \param p_count uint8_t
+         */
+        void setMaxIdleConnectionsPerHost(uint8_t p_count);
+
+        /**
+         * \brief Sets time after which idle connection is closed. Default value is 30 seconds.
+         * Keep-Alive timeout announced by the server is used if it is shorter.
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setIdleTimeOut(std::chrono::milliseconds p_timeout);
+
+        /**
+         * \brief Returns idle connection to p_key if there is one which is still alive.
+         * \param p_key const Key&
+         * \return std::unique_ptr< tristan::sockets::InetSocket > or nullptr.
+         */
+        [[nodiscard]] auto acquire(const Key& p_key) -> std::unique_ptr< tristan::sockets::InetSocket >;
+
+        /**
+         * \brief Returns connection to the pool after p_response was completely read, unless the server asked to close it.
+         * \param p_key const Key&
+         * \param p_socket std::unique_ptr< tristan::sockets::InetSocket >&&
+         * \param p_response const HttpResponse&
+         */
+        void release(const Key& p_key, std::unique_ptr< tristan::sockets::InetSocket >&& p_socket, const HttpResponse& p_response);
+
+        /**
+         * \brief Closes all idle connections.
+         */
+        void clear();
+
+    protected:
+    private:
+        ConnectionPool();
+
+        struct IdleConnection {
+            std::unique_ptr< tristan::sockets::InetSocket > m_socket;
+            std::chrono::steady_clock::time_point m_expiry;
+        };
+
+        std::mutex m_lock;
+
+        std::map< Key, std::deque< IdleConnection > > m_connections;
+
+        std::chrono::milliseconds m_idle_timeout;
+
+        uint8_t m_max_idle_connections_per_host;
+
+        /**
+         * \brief Returns how long the connection may stay idle according to p_response or std::nullopt if it should be closed.
+         * \param p_response const HttpResponse&
+         * \return std::optional< std::chrono::milliseconds >
+         */
+        [[nodiscard]] auto _keepAliveTimeOut(const HttpResponse& p_response) const -> std::optional< std::chrono::milliseconds >;
+
+        /**
+         * \brief Returns false if the peer closed the connection or sent unexpected data.
+         * \param p_socket const tristan::sockets::InetSocket&
+         * \return bool
+         */
+        [[nodiscard]] static auto _alive(const tristan::sockets::InetSocket& p_socket) -> bool;
+
+        void _evictExpired(std::chrono::steady_clock::time_point p_now);
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //CONNECTION_POOL_HPP
@@ -0,0 +1,130 @@
+#ifndef CONNECTION_RACE_HPP
+#define CONNECTION_RACE_HPP
+
+#include "resolver.hpp"
+
+#include <inet_socket.hpp>
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <system_error>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class ConnectionRace
+     * \brief Connects to one of the host addresses by starting staggered attempts as described in RFC 8305 (Happy Eyeballs).
+     * Addresses are tried alternating IPv6 and IPv4, a new attempt is started when the previous one fails or after the attempt delay.
+     * The first established connection wins and the rest are closed.
+     * \Threadsafe No
+     */
+    class ConnectionRace {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_addresses const std::vector< IP >&
+         * \param p_port uint16_t in network byte order.
+         * \param p_host const std::string&. Host name which is used for SNI and TLS session resumption.
+         * \param p_ssl bool
+         */
+        ConnectionRace(const std::vector< IP >& p_addresses, uint16_t p_port, const std::string& p_host, bool p_ssl);
+
+        ConnectionRace(const ConnectionRace& p_other) = delete;
+        ConnectionRace(ConnectionRace&& p_other) = delete;
+
+        ConnectionRace& operator=(const ConnectionRace& p_other) = delete;
+        ConnectionRace& operator=(ConnectionRace&& p_other) = delete;
+
+        ~ConnectionRace() = default;
+
+        /**
+         * \brief Sets delay after which next attempt is started if none of the started ones succeeded. Default value is 250 ms.
+         * \param p_delay std::chrono::milliseconds
+         */
+        static void setAttemptDelay(std::chrono::milliseconds p_delay);
+
+        /**
+         * \brief Starts attempt if it is due and drives started attempts.
+         * \return true if one of the attempts connected.
+         */
+        [[nodiscard]] auto advance() -> bool;
+
+        /**
+         * \brief Returns connected socket. Should be invoked after advance() returned true.
+         * \return std::unique_ptr< tristan::sockets::InetSocket >
+         */
+        [[nodiscard]] auto winner() -> std::unique_ptr< tristan::sockets::InetSocket >;
+
+        /**
+         * \brief Returns descriptors of the attempts which are in progress and wait for the socket to become readable, e.g. TLS handshake wants to read.
+         * \return const std::vector< int >&
+         */
+        [[nodiscard]] auto readFds() const noexcept -> const std::vector< int >&;
+
+        /**
+         * \brief Returns descriptors of the attempts which are in progress and wait for the socket to become writable.
+         * \return const std::vector< int >&
+         */
+        [[nodiscard]] auto writeFds() const noexcept -> const std::vector< int >&;
+
+        /**
+         * \brief Returns time point when the next attempt should be started.
+         * \return std::chrono::steady_clock::time_point which is max() if all addresses were tried.
+         */
+        [[nodiscard]] auto nextAttemptTime() const noexcept -> std::chrono::steady_clock::time_point;
+
+        /**
+         * \brief Returns true if all attempts failed.
+         * \return bool
+         */
+        [[nodiscard]] auto failed() const noexcept -> bool;
+
+        /**
+         * \brief Returns error of the last failed attempt.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+    protected:
+    private:
+        std::vector< IP > m_addresses;
+
+        std::vector< std::unique_ptr< tristan::sockets::InetSocket > > m_attempts;
+
+        std::vector< int > m_read_fds;
+
+        std::vector< int > m_write_fds;
+
+        /**
+         * \brief Parallel to m_attempts. True if the attempt stopped because it has to read.
+         */
+        std::vector< bool > m_want_read;
+
+        std::unique_ptr< tristan::sockets::InetSocket > m_winner;
+
+        std::string m_host;
+
+        std::error_code m_error;
+
+        std::chrono::steady_clock::time_point m_next_attempt_time;
+
+        size_t m_next_address;
+
+        uint16_t m_port;
+
+        bool m_ssl;
+
+        void _startAttempt(std::chrono::steady_clock::time_point p_now);
+
+        void _clearAttempts();
+
+        [[nodiscard]] static auto _inProgress(const std::error_code& p_error) -> bool;
+
+        [[nodiscard]] static auto _wantRead(const std::error_code& p_error) -> bool;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //CONNECTION_RACE_HPP
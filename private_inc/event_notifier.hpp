@@ -0,0 +1,58 @@
+#ifndef EVENT_NOTIFIER_HPP
+#define EVENT_NOTIFIER_HPP
+
+#include <system_error>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class EventNotifier
+     * \brief Descriptor which becomes readable once notify() is called from any thread.
+     * Lets a coroutine wait in the reactor for completion of work which is done outside of it, e.g. host name resolution.
+     * \Threadsafe Yes
+     */
+    class EventNotifier {
+    public:
+        /**
+         * \brief Constructor. Creates eventfd.
+         */
+        EventNotifier();
+
+        EventNotifier(const EventNotifier& p_other) = delete;
+        EventNotifier(EventNotifier&& p_other) = delete;
+
+        EventNotifier& operator=(const EventNotifier& p_other) = delete;
+        EventNotifier& operator=(EventNotifier&& p_other) = delete;
+
+        /**
+         * \brief Destructor. Closes eventfd.
+         */
+        ~EventNotifier();
+
+        /**
+         * \brief Makes the descriptor readable.
+         */
+        void notify();
+
+        /**
+         * \brief Returns descriptor to wait for.
+         * \return int, -1 if eventfd could not be created.
+         */
+        [[nodiscard]] auto fd() const noexcept -> int;
+
+        /**
+         * \brief Returns error of eventfd creation.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+    protected:
+    private:
+        std::error_code m_error;
+
+        int m_fd;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //EVENT_NOTIFIER_HPP
@@ -0,0 +1,89 @@
+#ifndef FILE_BODY_SENDER_HPP
+#define FILE_BODY_SENDER_HPP
+
+#include "http_request.hpp"
+
+#include <inet_socket.hpp>
+
+#include <vector>
+#include <system_error>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class FileBodySender
+     * \brief Streams part of the file to the socket without loading it into memory.
+     * Plain sockets are fed by sendfile so data never leaves the kernel, TLS sockets are fed by chunks read into the reusable buffer.
+     * \Threadsafe No
+     */
+    class FileBodySender {
+    public:
+        /**
+         * \brief Constructor. Opens the file.
+         * \param p_socket tristan::sockets::InetSocket&. Should be connected.
+         * \param p_body const FileBody&
+         */
+        FileBodySender(tristan::sockets::InetSocket& p_socket, const FileBody& p_body);
+
+        FileBodySender(const FileBodySender& p_other) = delete;
+        FileBodySender(FileBodySender&& p_other) = delete;
+
+        FileBodySender& operator=(const FileBodySender& p_other) = delete;
+        FileBodySender& operator=(FileBodySender&& p_other) = delete;
+
+        /**
+         * \brief Destructor. Closes the file.
+         */
+        ~FileBodySender();
+
+        /**
+         * \brief Sends up to p_frame_size bytes of the file.
+         * \param p_frame_size uint16_t
+         * \return uint64_t number of bytes sent.
+         */
+        [[nodiscard]] auto send(uint16_t p_frame_size) -> uint64_t;
+
+        /**
+         * \brief Returns true if the whole body was sent.
+         * \return bool
+         */
+        [[nodiscard]] auto done() const noexcept -> bool;
+
+        /**
+         * \brief Returns true if the last send stopped because socket is not writable.
+         * \return bool
+         */
+        [[nodiscard]] auto wouldBlock() const noexcept -> bool;
+
+        /**
+         * \brief Returns error of opening the file or sending the data.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+    protected:
+    private:
+        tristan::sockets::InetSocket& m_socket;
+
+        std::vector< uint8_t > m_chunk;
+
+        std::error_code m_error;
+
+        uint64_t m_offset;
+
+        uint64_t m_bytes_remain;
+
+        uint64_t m_chunk_offset;
+
+        int m_fd;
+
+        bool m_would_block;
+
+        [[nodiscard]] auto _sendFile(uint16_t p_frame_size) -> uint64_t;
+
+        [[nodiscard]] auto _sendChunk(uint16_t p_frame_size) -> uint64_t;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //FILE_BODY_SENDER_HPP
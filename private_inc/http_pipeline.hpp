@@ -0,0 +1,88 @@
+#ifndef HTTP_PIPELINE_HPP
+#define HTTP_PIPELINE_HPP
+
+#include "http_request.hpp"
+
+#include <memory>
+#include <deque>
+#include <vector>
+#include <mutex>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class HttpPipeline
+     * \brief Queue of HTTP requests which are written back to back on one connection and answered by the server in the same order.
+     * \Threadsafe Yes
+     */
+    class HttpPipeline {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_depth uint8_t. Maximum number of requests which are not answered yet.
+         */
+        explicit HttpPipeline(uint8_t p_depth);
+
+        HttpPipeline(const HttpPipeline& p_other) = delete;
+        HttpPipeline(HttpPipeline&& p_other) = delete;
+
+        HttpPipeline& operator=(const HttpPipeline& p_other) = delete;
+        HttpPipeline& operator=(HttpPipeline&& p_other) = delete;
+
+        ~HttpPipeline() = default;
+
+        /**
+         * \brief Appends request to the pipeline.
+         * \param p_http_request std::shared_ptr< HttpRequest >
+         * \return false if pipeline is closed or full.
+         */
+        [[nodiscard]] auto append(std::shared_ptr< HttpRequest > p_http_request) -> bool;
+
+        /**
+         * \brief Moves requests which were not written yet to p_http_requests and marks them as in flight.
+         * Paused and canceled requests are dropped.
+         * \param p_http_requests std::vector< std::shared_ptr< HttpRequest > >&
+         */
+        void takeUnsent(std::vector< std::shared_ptr< HttpRequest > >& p_http_requests);
+
+        /**
+         * \brief Returns the oldest in flight request, which is the one the next response belongs to.
+         * \return std::shared_ptr< HttpRequest > or nullptr if there is nothing left, in which case the pipeline is closed.
+         */
+        [[nodiscard]] auto front() -> std::shared_ptr< HttpRequest >;
+
+        /**
+         * \brief Removes the oldest in flight request after its response was read.
+         */
+        void pop();
+
+        /**
+         * \brief Closes the pipeline.
+         * \return std::vector< std::shared_ptr< HttpRequest > > requests which were not answered.
+         */
+        [[nodiscard]] auto close() -> std::vector< std::shared_ptr< HttpRequest > >;
+
+        /**
+         * \brief Returns number of responses which were read through the pipeline.
+         * \return size_t
+         */
+        [[nodiscard]] auto answered() const -> size_t;
+
+    protected:
+    private:
+        mutable std::mutex m_lock;
+
+        std::deque< std::shared_ptr< HttpRequest > > m_unsent_requests;
+
+        std::deque< std::shared_ptr< HttpRequest > > m_in_flight_requests;
+
+        size_t m_answered;
+
+        uint8_t m_depth;
+
+        bool m_closed;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //HTTP_PIPELINE_HPP
@@ -0,0 +1,112 @@
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class MpscQueue
+     * \brief Bounded lock-free multi-producer single-consumer ring.
+     * \details Each cell carries a sequence number which tells producers and the consumer whose turn it is,
+     * hence producers contend only on a single fetch of the tail index.
+     * Based on the bounded queue by D. Vyukov.
+     * \tparam Type Movable and default constructible type of stored values.
+     * \Threadsafe push() - Yes, pop() - single consumer thread only.
+     */
+    template < class Type > class MpscQueue {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_capacity_power uint8_t Capacity of the queue is 2 ^ p_capacity_power.
+         */
+        explicit MpscQueue(uint8_t p_capacity_power = 10) :
+            m_cells(std::make_unique< Cell[] >(size_t{1} << p_capacity_power)),
+            m_mask((size_t{1} << p_capacity_power) - 1),
+            m_tail(0),
+            m_head(0) {
+            for (size_t index = 0; index <= m_mask; ++index) {
+                m_cells[index].m_sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue& p_other) = delete;
+        MpscQueue(MpscQueue&& p_other) = delete;
+
+        MpscQueue& operator=(const MpscQueue& p_other) = delete;
+        MpscQueue& operator=(MpscQueue&& p_other) = delete;
+
+        ~MpscQueue() = default;
+
+        /**
+         * \brief Pushes p_value to the tail of the queue.
+         * \param p_value Type&&. Is not moved from if the queue is full.
+         * \return false if the queue is full, true otherwise.
+         */
+        [[nodiscard]] auto push(Type&& p_value) -> bool {
+            auto tail = m_tail.load(std::memory_order_relaxed);
+            while (true) {
+                auto& cell = m_cells[tail & m_mask];
+                auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+                auto difference = static_cast< std::ptrdiff_t >(sequence) - static_cast< std::ptrdiff_t >(tail);
+                if (difference == 0) {
+                    if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                        cell.m_value = std::move(p_value);
+                        cell.m_sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    tail = m_tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * \brief Pops value from the head of the queue.
+         * \param p_value Type& which receives the value.
+         * \return false if the queue is empty, true otherwise.
+         */
+        [[nodiscard]] auto pop(Type& p_value) -> bool {
+            auto& cell = m_cells[m_head & m_mask];
+            auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+            if (sequence != m_head + 1) {
+                return false;
+            }
+            p_value = std::move(cell.m_value);
+            cell.m_value = Type();
+            cell.m_sequence.store(m_head + m_mask + 1, std::memory_order_release);
+            ++m_head;
+            return true;
+        }
+
+        /**
+         * \brief Returns whether the queue is empty. Should be invoked by the consumer thread.
+         * \return bool
+         */
+        [[nodiscard]] auto empty() const -> bool {
+            return m_cells[m_head & m_mask].m_sequence.load(std::memory_order_acquire) != m_head + 1;
+        }
+
+    protected:
+    private:
+        struct Cell {
+            std::atomic< size_t > m_sequence;
+            Type m_value;
+        };
+
+        std::unique_ptr< Cell[] > m_cells;
+
+        const size_t m_mask;
+
+        alignas(64) std::atomic< size_t > m_tail;
+        alignas(64) size_t m_head;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //MPSC_QUEUE_HPP
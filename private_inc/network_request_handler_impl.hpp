@@ -3,6 +3,8 @@
 
 #include "tcp_request.hpp"
 #include "http_request.hpp"
+#include "http_chunked_decoder.hpp"
+#include "http_response.hpp"
 #include "inet_socket.hpp"
 
 #include <chrono>
@@ -14,11 +16,106 @@ namespace tristan::network::private_ {
         NetworkRequestHandlerImpl();
 
         virtual ~NetworkRequestHandlerImpl();
+
+        /**
+         * \brief Sets number of bytes which are read from socket at once if request does not set its own value. Default value is 65535.
+         * \param p_size uint16_t
+         */
+        static void setDefaultReadFrameSize(uint16_t p_size);
+
+        /**
+         * \brief Sets number of bytes which are written to socket at once if request does not set its own value. Default value is 65535.
+         * \param p_size uint16_t
+         */
+        static void setDefaultWriteFrameSize(uint16_t p_size);
     protected:
+        /**
+         * \brief Returns number of bytes which should be read from socket at once for p_network_request.
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \return uint16_t
+         */
+        [[nodiscard]] static auto readFrameSize(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> uint16_t;
+        /**
+         * \brief Returns number of bytes which should be written to socket at once for p_network_request.
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \return uint16_t
+         */
+        [[nodiscard]] static auto writeFrameSize(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> uint16_t;
         static void debugNetworkRequestInfo(const std::shared_ptr< NetworkRequestBase >& p_network_request);
+        /**
+         * \brief Returns deadline of the whole request processing.
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \return std::chrono::steady_clock::time_point which is max() if total time out is not set.
+         */
+        [[nodiscard]] static auto totalDeadline(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> std::chrono::steady_clock::time_point;
+        /**
+         * \brief Returns deadline of the socket operation which should complete within p_timeout from now, bounded by p_total_deadline.
+         * \param p_timeout std::chrono::milliseconds
+         * \param p_total_deadline std::chrono::steady_clock::time_point
+         * \return std::chrono::steady_clock::time_point
+         */
+        [[nodiscard]] static auto deadline(std::chrono::milliseconds p_timeout, std::chrono::steady_clock::time_point p_total_deadline)
+            -> std::chrono::steady_clock::time_point;
+        /**
+         * \brief Sets host name resolution error to p_network_request if there is one.
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \return false if host name could not be resolved.
+         * \note Blocks until host name is resolved.
+         */
+        [[nodiscard]] static auto checkHostResolved(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> bool;
+        /**
+         * \brief Sets timed out error to p_network_request.
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         */
+        static void setTimedOut(const std::shared_ptr< NetworkRequestBase >& p_network_request);
+        /**
+         * \brief Returns true if socket operation failed with error other than the one which means that operation should be retried.
+         * \param p_socket const tristan::sockets::InetSocket&
+         * \return bool
+         */
+        [[nodiscard]] static auto connectionLost(const tristan::sockets::InetSocket& p_socket) -> bool;
+
+        /**
+         * \brief Returns total size of the buffers.
+         * \param p_buffers const std::vector< std::span< const uint8_t > >&
+         * \return uint64_t
+         */
+        [[nodiscard]] static auto buffersSize(const std::vector< std::span< const uint8_t > >& p_buffers) -> uint64_t;
+
+        /**
+         * \brief Reads up to p_size bytes from the socket directly into the response buffer of the request.
+         * \param p_socket tristan::sockets::InetSocket&
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \param p_size uint16_t
+         * \return uint64_t number of bytes which were read.
+         */
+        [[nodiscard]] static auto readResponseData(tristan::sockets::InetSocket& p_socket,
+                                                   const std::shared_ptr< NetworkRequestBase >& p_network_request,
+                                                   uint16_t p_size) -> uint64_t;
+
+        /**
+         * \brief Reads up to p_size bytes of the chunked body from the socket into the response buffer of the request and decodes them in place.
+         * Never reads beyond the end of the chunked body so the connection may be reused. Sets decoding error to the request.
+         * \param p_socket tristan::sockets::InetSocket&
+         * \param p_network_request const std::shared_ptr< NetworkRequestBase >&
+         * \param p_decoder HttpChunkedDecoder&
+         * \param p_size uint16_t
+         * \return uint64_t number of bytes which were read including chunked framing.
+         */
+        [[nodiscard]] static auto readChunkedResponseData(tristan::sockets::InetSocket& p_socket,
+                                                          const std::shared_ptr< NetworkRequestBase >& p_network_request,
+                                                          HttpChunkedDecoder& p_decoder,
+                                                          uint16_t p_size) -> uint64_t;
+
+        /**
+         * \brief Appends trailer fields collected by the decoder to the response headers.
+         * \param p_response HttpResponse&
+         * \param p_decoder const HttpChunkedDecoder&
+         */
+        static void addTrailers(HttpResponse& p_response, const HttpChunkedDecoder& p_decoder);
         [[nodiscard]] static bool
             checkSocketOperationErrorAndTimeOut(const tristan::sockets::InetSocket& p_socket,
-                                                std::chrono::time_point< std::chrono::system_clock, std::chrono::microseconds > p_time_point,
+                                                std::chrono::steady_clock::time_point p_deadline,
                                                 const std::shared_ptr< NetworkRequestBase >& p_network_request);
     };
 
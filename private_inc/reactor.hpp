@@ -0,0 +1,205 @@
+#ifndef REACTOR_HPP
+#define REACTOR_HPP
+
+#include "async_task.hpp"
+#include "timer_wheel.hpp"
+
+#include <sys/epoll.h>
+
+#include <array>
+#include <span>
+#include <vector>
+#include <chrono>
+#include <coroutine>
+#include <system_error>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class Reactor
+     * \brief Wraps epoll instance so that async tasks are resumed only when their socket is ready or their deadline passes.
+     * \Threadsafe No, except wake(). Should be used from the thread which runs AsyncRequestHandler.
+     */
+    class Reactor {
+    public:
+        /**
+         * \enum Event
+         * \brief Socket readiness which task is waiting for.
+         */
+        enum class Event : uint32_t {
+            READ = EPOLLIN,
+            WRITE = EPOLLOUT
+        };
+
+        /**
+         * \class Awaiter
+         * \brief Suspends current task until file descriptor becomes ready or deadline passes.
+         * \note The task is registered in the reactor of the thread which resumed it.
+         */
+        class Awaiter {
+        public:
+            Awaiter(int p_fd, Event p_event, std::chrono::steady_clock::time_point p_deadline) :
+                m_deadline(p_deadline),
+                m_task(nullptr),
+                m_fd(p_fd),
+                m_event(p_event) { }
+
+            Awaiter(std::span< const int > p_fds, Event p_event, std::chrono::steady_clock::time_point p_deadline) :
+                m_deadline(p_deadline),
+                m_fds(p_fds),
+                m_task(nullptr),
+                m_fd(-1),
+                m_event(p_event) { }
+
+            Awaiter(std::span< const int > p_read_fds, std::span< const int > p_write_fds, std::chrono::steady_clock::time_point p_deadline) :
+                m_deadline(p_deadline),
+                m_fds(p_write_fds),
+                m_read_fds(p_read_fds),
+                m_task(nullptr),
+                m_fd(-1),
+                m_event(Event::WRITE) { }
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+
+            void await_suspend(std::coroutine_handle<> p_handle);
+
+            /**
+             * \brief Returns false if the task was resumed because the deadline passed.
+             * \return bool
+             */
+            [[nodiscard]] auto await_resume() const noexcept -> bool { return m_task == nullptr || not m_task->m_timed_out; }
+
+        private:
+            std::chrono::steady_clock::time_point m_deadline;
+            /**
+             * \brief Descriptors to wait for. If empty m_fd is used.
+             */
+            std::span< const int > m_fds;
+            /**
+             * \brief Descriptors which are waited for READ in addition to m_fds.
+             */
+            std::span< const int > m_read_fds;
+            AsyncTask* m_task;
+            int m_fd;
+            Event m_event;
+        };
+
+        Reactor();
+
+        Reactor(const Reactor& p_other) = delete;
+        Reactor(Reactor&& p_other) = delete;
+
+        Reactor& operator=(const Reactor& p_other) = delete;
+        Reactor& operator=(Reactor&& p_other) = delete;
+
+        ~Reactor();
+
+        /**
+         * \brief Creates awaitable which suspends current task until p_fd is ready for p_event or p_deadline passes.
+         * \param p_fd int
+         * \param p_event Event
+         * \param p_deadline std::chrono::steady_clock::time_point
+         * \return Awaiter
+         */
+        [[nodiscard]] static auto waitFor(int p_fd, Event p_event, std::chrono::steady_clock::time_point p_deadline) -> Awaiter;
+
+        /**
+         * \brief Creates awaitable which suspends current task until any of p_fds is ready for p_event or p_deadline passes.
+         * \param p_fds std::span< const int >. Should stay valid until the task is resumed.
+         * \param p_event Event
+         * \param p_deadline std::chrono::steady_clock::time_point
+         * \return Awaiter
+         */
+        [[nodiscard]] static auto waitForAny(std::span< const int > p_fds, Event p_event, std::chrono::steady_clock::time_point p_deadline) -> Awaiter;
+
+        /**
+         * \brief Creates awaitable which suspends current task until any of p_read_fds is readable, any of p_write_fds is writable or p_deadline passes.
+         * \param p_read_fds std::span< const int >. Should stay valid until the task is resumed.
+         * \param p_write_fds std::span< const int >. Should stay valid until the task is resumed.
+         * \param p_deadline std::chrono::steady_clock::time_point
+         * \return Awaiter
+         */
+        [[nodiscard]] static auto waitForAny(std::span< const int > p_read_fds, std::span< const int > p_write_fds, std::chrono::steady_clock::time_point p_deadline)
+            -> Awaiter;
+
+        /**
+         * \brief Creates awaitable which suspends current task until p_time_point.
+         * \param p_time_point std::chrono::steady_clock::time_point
+         * \return Awaiter which resumes with false, since the wait always ends by the deadline.
+         */
+        [[nodiscard]] static auto sleepUntil(std::chrono::steady_clock::time_point p_time_point) -> Awaiter;
+
+        /**
+         * \brief Returns reactor of the calling thread.
+         * \return Reactor* or nullptr if thread does not run a reactor.
+         */
+        [[nodiscard]] static auto current() noexcept -> Reactor*;
+
+        /**
+         * \brief Sets reactor of the calling thread.
+         * \param p_reactor Reactor*
+         */
+        static void setCurrent(Reactor* p_reactor) noexcept;
+
+        /**
+         * \brief Returns error if epoll instance could not be created.
+         * \return const std::error_code&
+         */
+        [[nodiscard]] auto error() const noexcept -> const std::error_code&;
+
+        /**
+         * \brief Sets task which is being resumed. Awaiters register this task in epoll.
+         * \param p_task AsyncTask*
+         */
+        void setCurrentTask(AsyncTask* p_task) noexcept;
+
+        /**
+         * \brief Sets interval after which waiting task is resumed even if neither its socket is ready nor its deadline passed.
+         * Lets coroutines notice pause and cancel of silent requests. Default value is 250 ms.
+         * \param p_interval std::chrono::milliseconds
+         */
+        void setCheckInterval(std::chrono::milliseconds p_interval);
+
+        /**
+         * \brief Interrupts poll() from any thread.
+         * \Threadsafe Yes
+         */
+        void wake();
+
+        /**
+         * \brief Waits for readiness notifications and expired deadlines and appends tasks which are ready to p_ready_tasks.
+         * \param p_block bool. If false returns immediately, otherwise waits until notification, nearest timer or wake().
+         * \param p_ready_tasks std::vector< AsyncTask* >&
+         */
+        void poll(bool p_block, std::vector< AsyncTask* >& p_ready_tasks);
+
+    protected:
+    private:
+        std::array< epoll_event, 64 > m_events;
+
+        TimerWheel m_timers;
+
+        std::vector< TimerWheel::Timer* > m_expired_timers;
+
+        std::chrono::milliseconds m_check_interval;
+
+        std::error_code m_error;
+
+        AsyncTask* m_current_task;
+
+        int m_epoll_fd;
+
+        int m_wake_fd;
+
+        void _watch(std::span< const int > p_fds, Event p_event, std::span< const int > p_read_fds, std::chrono::steady_clock::time_point p_deadline);
+
+        [[nodiscard]] auto _arm(int p_fd, Event p_event) -> bool;
+
+        void _unwatch(AsyncTask* p_task);
+
+        void _cancelWait(AsyncTask* p_task);
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //REACTOR_HPP
@@ -0,0 +1,122 @@
+#ifndef REQUEST_SCHEDULER_HPP
+#define REQUEST_SCHEDULER_HPP
+
+#include "network_request_base.hpp"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+namespace tristan::network {
+
+    enum class SchedulingPolicy : uint8_t;
+
+}  // namespace tristan::network
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class RequestScheduler
+     * \brief Keeps pending requests in one intrusive FIFO per Priority and decides which request is dispatched next.
+     * \details Requests with Priority::OUT_OF_QUEUE are always dispatched first.
+     * Request with Priority::LOW which waited longer than the aging threshold is dispatched before any other queued request.
+     * \Threadsafe No
+     */
+    class RequestScheduler {
+    public:
+        RequestScheduler();
+
+        RequestScheduler(const RequestScheduler& p_other) = delete;
+        RequestScheduler(RequestScheduler&& p_other) = delete;
+
+        RequestScheduler& operator=(const RequestScheduler& p_other) = delete;
+        RequestScheduler& operator=(RequestScheduler&& p_other) = delete;
+
+        ~RequestScheduler();
+
+        /**
+         * \brief Sets how requests of different priorities are interleaved.
+         * \param p_policy SchedulingPolicy
+         */
+        void setPolicy(SchedulingPolicy p_policy);
+
+        /**
+         * \brief Sets number of requests dispatched from each queue per round when SchedulingPolicy::WEIGHTED_FAIR is used.
+         * Zero weight is treated as 1.
+         * \param p_high uint8_t
+         * \param p_normal uint8_t
+         * \param p_low uint8_t
+         */
+        void setWeights(uint8_t p_high, uint8_t p_normal, uint8_t p_low);
+
+        /**
+         * \brief Sets time after which request with Priority::LOW is dispatched ahead of other priorities.
+         * Zero disables aging.
+         * \param p_threshold std::chrono::milliseconds
+         */
+        void setAgingThreshold(std::chrono::milliseconds p_threshold);
+
+        /**
+         * \brief Appends request to the queue of its priority.
+         * \param p_request std::shared_ptr< NetworkRequestBase >&&
+         */
+        void push(std::shared_ptr< NetworkRequestBase >&& p_request);
+
+        /**
+         * \brief Removes next request according to policy.
+         * \return std::shared_ptr< NetworkRequestBase > or nullptr if there are no requests.
+         */
+        [[nodiscard]] auto pop() -> std::shared_ptr< NetworkRequestBase >;
+
+        [[nodiscard]] auto empty() const noexcept -> bool;
+
+        /**
+         * \brief Returns true if request with Priority::OUT_OF_QUEUE is queued, in which case it is the one pop() returns.
+         * \return bool
+         */
+        [[nodiscard]] auto hasOutOfQueue() const noexcept -> bool;
+
+        [[nodiscard]] auto size() const noexcept -> size_t;
+
+        /**
+         * \brief Returns copy of all queued requests from the highest priority to the lowest.
+         * \return std::vector< std::shared_ptr< NetworkRequestBase > >
+         */
+        [[nodiscard]] auto snapshot() const -> std::vector< std::shared_ptr< NetworkRequestBase > >;
+
+    protected:
+    private:
+        struct Queue {
+            std::shared_ptr< NetworkRequestBase > m_head;
+            NetworkRequestBase* m_tail = nullptr;
+            size_t m_size = 0;
+        };
+
+        /**
+         * \brief Queues indexed by Priority value.
+         */
+        std::array< Queue, 4 > m_queues;
+
+        std::array< uint8_t, 4 > m_weights;
+
+        std::array< uint8_t, 4 > m_credits;
+
+        std::chrono::milliseconds m_aging_threshold;
+
+        size_t m_size;
+
+        SchedulingPolicy m_policy;
+
+        Priority m_current_priority;
+
+        [[nodiscard]] auto _popFrom(Priority p_priority) -> std::shared_ptr< NetworkRequestBase >;
+
+        [[nodiscard]] auto _popWeighted() -> std::shared_ptr< NetworkRequestBase >;
+
+        [[nodiscard]] auto _queue(Priority p_priority) -> Queue&;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //REQUEST_SCHEDULER_HPP
@@ -0,0 +1,71 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <functional>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class ThreadPool
+     * \brief Fixed size pool of workers with bounded jobs queue.
+     * \Threadsafe Yes
+     */
+    class ThreadPool {
+    public:
+        /**
+         * \brief Constructor. Launches p_workers_count workers.
+         * \param p_workers_count uint8_t
+         * \param p_queue_limit uint16_t Maximum number of jobs waiting for a free worker.
+         */
+        ThreadPool(uint8_t p_workers_count, uint16_t p_queue_limit);
+
+        ThreadPool(const ThreadPool& p_other) = delete;
+        ThreadPool(ThreadPool&& p_other) = delete;
+
+        ThreadPool& operator=(const ThreadPool& p_other) = delete;
+        ThreadPool& operator=(ThreadPool&& p_other) = delete;
+
+        /**
+         * \brief Destructor. Discards queued jobs and joins workers.
+         */
+        ~ThreadPool();
+
+        /**
+         * \brief Queues the job. Blocks while the queue is full.
+         * \param p_job std::function< void() >&&
+         * \return false if pool was stopped and job was not queued, true otherwise.
+         */
+        [[nodiscard]] auto submit(std::function< void() >&& p_job) -> bool;
+
+        /**
+         * \brief Stops the pool and joins all workers.
+         * \param p_drain bool If true queued jobs are processed before workers exit, otherwise they are discarded.
+         */
+        void stop(bool p_drain);
+
+    protected:
+    private:
+        std::mutex m_jobs_lock;
+        std::condition_variable m_job_added;
+        std::condition_variable m_job_taken;
+
+        std::queue< std::function< void() > > m_jobs;
+
+        std::vector< std::thread > m_workers;
+
+        uint16_t m_queue_limit;
+
+        bool m_stopped;
+        bool m_drain;
+
+        void _work();
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //THREAD_POOL_HPP
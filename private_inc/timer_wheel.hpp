@@ -0,0 +1,118 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <array>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class TimerWheel
+     * \brief Hierarchical timer wheel with millisecond resolution based on steady clock.
+     * \details Four levels of 64 slots cover about 4.6 hours, later deadlines are kept in the last slot and cascaded when reached.
+     * Schedule and cancel are O(1), advance is O(1) per elapsed tick plus the number of cascaded and expired timers.
+     * Timers are intrusive, hence objects which need a deadline derive from TimerWheel::Timer.
+     * \Threadsafe No
+     */
+    class TimerWheel {
+    public:
+        /**
+         * \class Timer
+         * \brief Intrusive node of the timer wheel.
+         */
+        class Timer {
+            friend class TimerWheel;
+
+        public:
+            Timer() = default;
+
+            Timer(const Timer& p_other) = delete;
+            Timer(Timer&& p_other) = delete;
+
+            Timer& operator=(const Timer& p_other) = delete;
+            Timer& operator=(Timer&& p_other) = delete;
+
+            ~Timer() {
+                if (m_wheel != nullptr) {
+                    m_wheel->cancel(*this);
+                }
+            }
+
+            [[nodiscard]] auto scheduled() const noexcept -> bool { return m_wheel != nullptr; }
+
+        private:
+            TimerWheel* m_wheel = nullptr;
+            Timer** m_slot = nullptr;
+            Timer* m_next = nullptr;
+            Timer* m_prev = nullptr;
+            uint64_t m_expiry_tick = 0;
+        };
+
+        TimerWheel();
+
+        TimerWheel(const TimerWheel& p_other) = delete;
+        TimerWheel(TimerWheel&& p_other) = delete;
+
+        TimerWheel& operator=(const TimerWheel& p_other) = delete;
+        TimerWheel& operator=(TimerWheel&& p_other) = delete;
+
+        ~TimerWheel();
+
+        /**
+         * \brief Schedules p_timer to expire at p_expiry. Already scheduled timer is rescheduled.
+         * \param p_timer Timer&
+         * \param p_expiry std::chrono::steady_clock::time_point
+         */
+        void schedule(Timer& p_timer, std::chrono::steady_clock::time_point p_expiry);
+
+        /**
+         * \brief Removes p_timer from the wheel if it is scheduled.
+         * \param p_timer Timer&
+         */
+        void cancel(Timer& p_timer);
+
+        /**
+         * \brief Moves the wheel to p_now and appends expired timers to p_expired.
+         * \param p_now std::chrono::steady_clock::time_point
+         * \param p_expired std::vector< Timer* >&
+         */
+        void advance(std::chrono::steady_clock::time_point p_now, std::vector< Timer* >& p_expired);
+
+        /**
+         * \brief Returns time until the wheel should be advanced next time.
+         * \return std::chrono::milliseconds or -1 ms if no timer is scheduled.
+         */
+        [[nodiscard]] auto nextTimeout() const -> std::chrono::milliseconds;
+
+        [[nodiscard]] auto empty() const noexcept -> bool;
+
+    protected:
+    private:
+        static constexpr uint8_t bits_per_level = 6;
+        static constexpr uint64_t slots_per_level = uint64_t{1} << bits_per_level;
+        static constexpr uint64_t slot_mask = slots_per_level - 1;
+        static constexpr uint8_t levels = 4;
+        static constexpr uint64_t wheel_range = uint64_t{1} << (bits_per_level * levels);
+
+        std::array< std::array< Timer*, slots_per_level >, levels > m_slots;
+
+        std::chrono::steady_clock::time_point m_origin;
+
+        uint64_t m_current_tick;
+
+        size_t m_timers_count;
+
+        [[nodiscard]] auto _tick(std::chrono::steady_clock::time_point p_time_point) const -> uint64_t;
+
+        void _insert(Timer& p_timer);
+
+        void _unlink(Timer& p_timer);
+
+        void _cascade(uint8_t p_level);
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //TIMER_WHEEL_HPP
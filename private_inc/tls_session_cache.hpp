@@ -0,0 +1,95 @@
+#ifndef TLS_SESSION_CACHE_HPP
+#define TLS_SESSION_CACHE_HPP
+
+#include <inet_socket.hpp>
+
+#include <openssl/ssl.h>
+
+#include <memory>
+#include <string>
+#include <map>
+#include <list>
+#include <mutex>
+#include <utility>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class TlsSessionCache
+     * \brief Keeps TLS sessions of previous connections so that following handshakes to the same host are resumed.
+     * Works both with session tickets and session IDs since both are represented by SSL_SESSION.
+     * \Threadsafe Yes
+     */
+    class TlsSessionCache {
+    public:
+        TlsSessionCache(const TlsSessionCache& p_other) = delete;
+        TlsSessionCache(TlsSessionCache&& p_other) = delete;
+
+        TlsSessionCache& operator=(const TlsSessionCache& p_other) = delete;
+        TlsSessionCache& operator=(TlsSessionCache&& p_other) = delete;
+
+        ~TlsSessionCache() = default;
+
+        static auto instance() -> TlsSessionCache&;
+
+        /**
+         * \brief Sets maximum number of cached sessions. Default value is 256. Zero disables the cache.
+         * \param p_capacity uint16_t
+         */
+        void setCapacity(uint16_t p_capacity);
+
+        /**
+         * \brief Hands cached session of p_host:p_port to p_socket. Should be invoked before connect().
+         * TLS 1.3 sessions are removed from the cache since tickets should not be reused.
+         * \param p_host const std::string&
+         * \param p_port uint16_t
+         * \param p_socket tristan::sockets::InetSocket&
+         */
+        void apply(const std::string& p_host, uint16_t p_port, tristan::sockets::InetSocket& p_socket);
+
+        /**
+         * \brief Stores session of p_socket if it may be resumed.
+         * Should be invoked after the response was read, since TLS 1.3 tickets are sent by the server after the handshake.
+         * \param p_host const std::string&
+         * \param p_port uint16_t
+         * \param p_socket const tristan::sockets::InetSocket&
+         */
+        void store(const std::string& p_host, uint16_t p_port, const tristan::sockets::InetSocket& p_socket);
+
+        /**
+         * \brief Removes all cached sessions.
+         */
+        void clear();
+
+    protected:
+    private:
+        TlsSessionCache();
+
+        struct SessionDeleter {
+            void operator()(SSL_SESSION* p_session) const noexcept { SSL_SESSION_free(p_session); }
+        };
+
+        using Key = std::pair< std::string, uint16_t >;
+
+        struct CachedSession {
+            std::unique_ptr< SSL_SESSION, SessionDeleter > m_session;
+            /**
+             * \brief Position in m_lru, the most recently stored session is at the back.
+             */
+            std::list< Key >::iterator m_position;
+        };
+
+        std::mutex m_lock;
+
+        std::map< Key, CachedSession > m_sessions;
+
+        std::list< Key > m_lru;
+
+        uint16_t m_capacity;
+
+        void _erase(std::map< Key, CachedSession >::iterator p_session);
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //TLS_SESSION_CACHE_HPP
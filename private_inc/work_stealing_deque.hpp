@@ -0,0 +1,119 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace tristan::network::private_ {
+
+    /**
+     * \class WorkStealingDeque
+     * \brief Bounded lock-free Chase-Lev deque of pointers.
+     * \details The owner thread pushes and pops at the bottom, any other thread may steal from the top.
+     * Based on "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al., 2013.
+     * \tparam Type Type of pointed objects.
+     * \Threadsafe push() and pop() - owner thread only, steal() - Yes.
+     */
+    template < class Type > class WorkStealingDeque {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_capacity_power uint8_t Capacity of the deque is 2 ^ p_capacity_power.
+         */
+        explicit WorkStealingDeque(uint8_t p_capacity_power = 10) :
+            m_buffer(std::make_unique< std::atomic< Type* >[] >(size_t{1} << p_capacity_power)),
+            m_mask(static_cast< int64_t >((size_t{1} << p_capacity_power) - 1)),
+            m_top(0),
+            m_bottom(0) { }
+
+        WorkStealingDeque(const WorkStealingDeque& p_other) = delete;
+        WorkStealingDeque(WorkStealingDeque&& p_other) = delete;
+
+        WorkStealingDeque& operator=(const WorkStealingDeque& p_other) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&& p_other) = delete;
+
+        ~WorkStealingDeque() = default;
+
+        /**
+         * \brief Pushes p_item to the bottom of the deque.
+         * \param p_item Type*
+         * \return false if deque is full, true otherwise.
+         */
+        [[nodiscard]] auto push(Type* p_item) -> bool {
+            auto bottom = m_bottom.load(std::memory_order_relaxed);
+            auto top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask) {
+                return false;
+            }
+            m_buffer[static_cast< size_t >(bottom & m_mask)].store(p_item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * \brief Pops item from the bottom of the deque.
+         * \return Type* or nullptr if deque is empty.
+         */
+        [[nodiscard]] auto pop() -> Type* {
+            auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            auto* item = m_buffer[static_cast< size_t >(bottom & m_mask)].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                //Last item - race against thieves.
+                if (not m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * \brief Steals item from the top of the deque.
+         * \return Type* or nullptr if deque is empty or another thread won the race.
+         */
+        [[nodiscard]] auto steal() -> Type* {
+            auto top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom) {
+                return nullptr;
+            }
+            auto* item = m_buffer[static_cast< size_t >(top & m_mask)].load(std::memory_order_relaxed);
+            if (not m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /**
+         * \brief Returns approximate number of items.
+         * \return size_t
+         */
+        [[nodiscard]] auto size() const -> size_t {
+            auto bottom = m_bottom.load(std::memory_order_relaxed);
+            auto top = m_top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast< size_t >(bottom - top) : 0;
+        }
+
+    protected:
+    private:
+        std::unique_ptr< std::atomic< Type* >[] > m_buffer;
+
+        const int64_t m_mask;
+
+        alignas(64) std::atomic< int64_t > m_top;
+        alignas(64) std::atomic< int64_t > m_bottom;
+    };
+
+}  // namespace tristan::network::private_
+
+#endif  //WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,122 @@
+#include "admission_controller.hpp"
+
+tristan::network::private_::AdmissionController::AdmissionController() :
+    m_global_limit(50),
+    m_host_limit(6),
+    m_active_requests(0) { }
+
+auto tristan::network::private_::AdmissionController::hostKey(const NetworkRequestBase& p_request) -> std::string {
+    return p_request.url().host().empty() ? p_request.url().hostIP().as_string : p_request.url().host();
+}
+
+void tristan::network::private_::AdmissionController::setGlobalLimit(uint16_t p_limit) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_global_limit = p_limit;
+}
+
+void tristan::network::private_::AdmissionController::setHostLimit(uint16_t p_limit) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_host_limit = p_limit;
+    //Raised limit may unblock any host with parked requests.
+    m_ready_hosts.clear();
+    for (const auto& [name, host]: m_hosts) {
+        if (not host.m_waiting_requests.empty()) {
+            m_ready_hosts.push_back(name);
+        }
+    }
+}
+
+auto tristan::network::private_::AdmissionController::hasFreeSlot() -> bool {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    return tristan::network::private_::AdmissionController::_hasFreeSlot();
+}
+
+auto tristan::network::private_::AdmissionController::hasAdmissible() -> bool {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    return tristan::network::private_::AdmissionController::_hasFreeSlot() && tristan::network::private_::AdmissionController::_frontReadyHost() != nullptr;
+}
+
+auto tristan::network::private_::AdmissionController::popAdmissible() -> std::shared_ptr< NetworkRequestBase > {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (not tristan::network::private_::AdmissionController::_hasFreeSlot()) {
+        return nullptr;
+    }
+    auto* host = tristan::network::private_::AdmissionController::_frontReadyHost();
+    if (host == nullptr) {
+        return nullptr;
+    }
+    auto request = std::move(host->m_waiting_requests.front());
+    host->m_waiting_requests.pop_front();
+    ++host->m_active_requests;
+    ++m_active_requests;
+    return request;
+}
+
+auto tristan::network::private_::AdmissionController::tryAdmit(std::shared_ptr< NetworkRequestBase >& p_request) -> bool {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    auto host_key = tristan::network::private_::AdmissionController::hostKey(*p_request);
+    auto& host = m_hosts[host_key];
+    //Global limit may be lowered after the dispatcher checked it, hence the request waits for a slot like any other parked one.
+    if (not tristan::network::private_::AdmissionController::_hasFreeSlot()) {
+        host.m_waiting_requests.emplace_back(std::move(p_request));
+        if (tristan::network::private_::AdmissionController::_hostHasFreeSlot(host)) {
+            m_ready_hosts.push_back(std::move(host_key));
+        }
+        return false;
+    }
+    //Parked requests of the host are admitted first to keep the order of requests to the same host.
+    if (not tristan::network::private_::AdmissionController::_hostHasFreeSlot(host) || not host.m_waiting_requests.empty()) {
+        host.m_waiting_requests.emplace_back(std::move(p_request));
+        return false;
+    }
+    ++host.m_active_requests;
+    ++m_active_requests;
+    return true;
+}
+
+void tristan::network::private_::AdmissionController::release(const std::string& p_host) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (m_active_requests > 0) {
+        --m_active_requests;
+    }
+    auto host_iterator = m_hosts.find(p_host);
+    if (host_iterator == m_hosts.end()) {
+        return;
+    }
+    auto& host = host_iterator->second;
+    if (host.m_active_requests > 0) {
+        --host.m_active_requests;
+    }
+    if (not host.m_waiting_requests.empty()) {
+        m_ready_hosts.push_back(p_host);
+    } else if (host.m_active_requests == 0) {
+        m_hosts.erase(host_iterator);
+    }
+}
+
+auto tristan::network::private_::AdmissionController::parkedRequests() -> std::vector< std::shared_ptr< NetworkRequestBase > > {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    std::vector< std::shared_ptr< NetworkRequestBase > > requests;
+    for (const auto& [name, host]: m_hosts) {
+        requests.insert(requests.end(), host.m_waiting_requests.begin(), host.m_waiting_requests.end());
+    }
+    return requests;
+}
+
+auto tristan::network::private_::AdmissionController::_hasFreeSlot() const -> bool { return m_global_limit == 0 || m_active_requests < m_global_limit; }
+
+auto tristan::network::private_::AdmissionController::_hostHasFreeSlot(const Host& p_host) const -> bool {
+    return m_host_limit == 0 || p_host.m_active_requests < m_host_limit;
+}
+
+auto tristan::network::private_::AdmissionController::_frontReadyHost() -> Host* {
+    while (not m_ready_hosts.empty()) {
+        auto host_iterator = m_hosts.find(m_ready_hosts.front());
+        if (host_iterator != m_hosts.end() && not host_iterator->second.m_waiting_requests.empty()
+            && tristan::network::private_::AdmissionController::_hostHasFreeSlot(host_iterator->second)) {
+            return &host_iterator->second;
+        }
+        m_ready_hosts.pop_front();
+    }
+    return nullptr;
+}
@@ -1,44 +1,87 @@
 #include "async_network_request_handler_impl.hpp"
 #include "network_logger.hpp"
 #include "http_response.hpp"
+#include "tls_session_cache.hpp"
+#include "connection_race.hpp"
+#include "file_body_sender.hpp"
+#include "event_notifier.hpp"
 
 #include <socket_error.hpp>
 
-tristan::network::private_::AsyncNetworkRequestHandlerImpl::AsyncNetworkRequestHandlerImpl() = default;
+#include <charconv>
+
+tristan::network::private_::AsyncNetworkRequestHandlerImpl::AsyncNetworkRequestHandlerImpl() :
+    m_http_pipelining_depth(0) { }
 
 tristan::network::private_::AsyncNetworkRequestHandlerImpl::~AsyncNetworkRequestHandlerImpl() = default;
 
-auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request)
+auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request, bool p_pipelining_allowed)
     -> tristan::ResumableCoroutine {
     if (auto tcp_ptr = std::dynamic_pointer_cast< tristan::network::TcpRequest >(p_network_request)) {
         return handleTcpRequest(tcp_ptr);
     } else if (auto http_ptr = std::dynamic_pointer_cast< tristan::network::HttpRequest >(p_network_request)) {
-        return handleHTTPRequest(http_ptr);
+        //Only GET requests are pipelined since they are idempotent and may be safely resent if the connection is closed.
+        if (not p_pipelining_allowed || m_http_pipelining_depth < 2 || not std::dynamic_pointer_cast< tristan::network::GetRequest >(http_ptr)) {
+            return handleHTTPRequest(http_ptr, nullptr);
+        }
+        //Host name is used as a key since the address may not be resolved yet.
+        HttpPipelineKey pipeline_key{http_ptr->url().host(), http_ptr->url().portUint16_t_network_byte_order(), http_ptr->isSSL()};
+        std::scoped_lock< std::mutex > lock(m_http_pipelines_lock);
+        auto& pipeline = m_http_pipelines[pipeline_key];
+        if (pipeline && pipeline->append(http_ptr)) {
+            return handlePipelinedHttpRequest(http_ptr);
+        }
+        pipeline = std::make_shared< tristan::network::private_::HttpPipeline >(m_http_pipelining_depth);
+        static_cast< void >(pipeline->append(http_ptr));
+        return handleHTTPRequest(http_ptr, pipeline);
     }
     return handleUnimplementedRequest(p_network_request);
 }
 
+void tristan::network::private_::AsyncNetworkRequestHandlerImpl::setHttpPipeliningDepth(uint8_t p_depth) { m_http_pipelining_depth = p_depth; }
+
+void tristan::network::private_::AsyncNetworkRequestHandlerImpl::setRequeueFunction(std::function< void(std::shared_ptr< NetworkRequestBase >&&) >&& p_function) {
+    m_requeue_function = std::move(p_function);
+}
+
 auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleTcpRequest(std::shared_ptr< tristan::network::TcpRequest > p_tcp_request)
     -> tristan::ResumableCoroutine {
     netInfo("Starting processing of request " + p_tcp_request->uuid());
 
-    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_tcp_request);
-
-    tristan::sockets::InetSocket socket;
-
-    if (socket.error()) {
-        netError(socket.error().message());
-        p_tcp_request->request_handlers_api.setError(socket.error());
+    //Host name is resolved in background and the reactor thread should not block on it.
+    auto resolve_deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(
+        p_tcp_request->connectTimeOut(), tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_tcp_request));
+    //Resolver thread makes the notifier readable, so the task is resumed by the reactor instead of polling the result.
+    std::shared_ptr< tristan::network::private_::EventNotifier > resolve_notifier;
+    while (not p_tcp_request->url().hostResolved()) {
+        if (p_tcp_request->isPaused() || p_tcp_request->isCanceled()) {
+            co_return;
+        }
+        if (std::chrono::steady_clock::now() >= resolve_deadline) {
+            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_tcp_request);
+            co_return;
+        }
+        if (not resolve_notifier) {
+            resolve_notifier = std::make_shared< tristan::network::private_::EventNotifier >();
+            if (not p_tcp_request->url().notifyWhenHostResolved([resolve_notifier]() -> void { resolve_notifier->notify(); })) {
+                continue;
+            }
+        }
+        static_cast< void >(co_await Reactor::waitFor(resolve_notifier->fd(), Reactor::Event::READ, resolve_deadline));
+    }
+    if (not tristan::network::private_::NetworkRequestHandlerImpl::checkHostResolved(p_tcp_request)) {
         co_return;
     }
 
+    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_tcp_request);
+
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
 
-    socket.setHost(p_tcp_request->url().hostIP().as_int, p_tcp_request->url().host());
-    socket.setPort(p_tcp_request->url().portUint16_t_network_byte_order());
-    socket.setNonBlocking();
-    auto start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (not socket.connected()) {
+    auto total_deadline = tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_tcp_request);
+    auto deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->connectTimeOut(), total_deadline);
+    tristan::network::private_::ConnectionRace race(
+        p_tcp_request->url().hostIPList(), p_tcp_request->url().portUint16_t_network_byte_order(), p_tcp_request->url().host(), false);
+    while (not race.advance()) {
         if (p_tcp_request->isPaused()) {
             netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
             co_return;
@@ -47,23 +90,27 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleTcpReques
             netInfo("Network request is cancelled tcp_request->uuid() = " + p_tcp_request->uuid());
             co_return;
         }
-        netInfo("Connecting to " + p_tcp_request->url().hostIP().as_string);
-        netDebug("tcp_request->uuid() = " + p_tcp_request->uuid());
-
-        socket.connect();
-
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+        if (race.failed()) {
+            netError(race.error().message());
+            p_tcp_request->request_handlers_api.setError(race.error());
             co_return;
         }
-        co_await std::suspend_always();
-        socket.resetError();
+        if (std::chrono::steady_clock::now() >= deadline) {
+            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_tcp_request);
+            co_return;
+        }
+        //Wakes up either when one of the attempts is writable or when the next attempt is due.
+        static_cast< void >(co_await Reactor::waitForAny(race.readFds(), race.writeFds(), std::min(race.nextAttemptTime(), deadline)));
     }
+    auto socket_ptr = race.winner();
+    auto& socket = *socket_ptr;
 
     uint64_t bytes_written = 0;
-    uint64_t bytes_to_write = p_tcp_request->requestData().size();
+    auto request_buffers = p_tcp_request->requestBuffers();
+    uint64_t bytes_to_write = tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(request_buffers);
 
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::WRITING);
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
     while (bytes_written < bytes_to_write) {
         if (p_tcp_request->isPaused()) {
             netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
@@ -75,19 +122,31 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleTcpReques
         }
         netInfo("Writing to " + p_tcp_request->url().hostIP().as_string);
         auto bytes_remain = bytes_to_write - bytes_written;
-        uint8_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-        bytes_written += socket.write(p_tcp_request->requestData(), current_frame_size, bytes_written);
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+        uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(p_tcp_request), bytes_remain);
+        auto frame_bytes_written = socket.writev(request_buffers, current_frame_size, bytes_written);
+        if (frame_bytes_written != 0) {
+            bytes_written += frame_bytes_written;
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
+        }
+        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_tcp_request)) {
             co_return;
         }
-        co_await std::suspend_always();
+        if (socket.error()) {
+            if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::WRITE, deadline)) {
+                tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_tcp_request);
+                co_return;
+            }
+        } else {
+            co_await std::suspend_always();
+        }
         socket.resetError();
     }
 
     if (p_tcp_request->bytesToRead() != 0) {
+        p_tcp_request->request_handlers_api.reserveResponseData(p_tcp_request->bytesToRead());
         uint64_t bytes_read = 0;
         uint64_t bytes_to_read = p_tcp_request->bytesToRead();
-        start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->firstByteTimeOut(), total_deadline);
         while (bytes_read < bytes_to_read) {
             if (p_tcp_request->isPaused()) {
                 netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
@@ -98,194 +157,221 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleTcpReques
                 co_return;
             }
             auto bytes_remain = bytes_to_read - bytes_read;
-            uint8_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-            auto data = socket.read(current_frame_size);
+            uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_tcp_request), bytes_remain);
+            auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readResponseData(socket, p_tcp_request, current_frame_size);
 
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_tcp_request)) {
                 co_return;
             }
-            if (not data.empty()) {
-                netDebug("data.size() = " + std::to_string(data.size()));
-                netDebug("data = " + std::string(data.begin(), data.end()));
-                bytes_read += data.size();
-                p_tcp_request->request_handlers_api.addResponseData(std::move(data));
+            if (frame_bytes_read != 0) {
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
+                netDebug("frame_bytes_read = " + std::to_string(frame_bytes_read));
+                bytes_read += frame_bytes_read;
                 if (p_tcp_request->error()) {
                     netError(p_tcp_request->error().message());
                     co_return;
                 }
             }
-            co_await std::suspend_always();
+            if (socket.error()) {
+                if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::READ, deadline)) {
+                    tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_tcp_request);
+                    co_return;
+                }
+            } else {
+                co_await std::suspend_always();
+            }
             socket.resetError();
         }
     }
+    if (p_tcp_request->isSSL()) {
+        tristan::network::private_::TlsSessionCache::instance().store(
+            p_tcp_request->url().host(), p_tcp_request->url().portUint16_t_network_byte_order(), socket);
+    }
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
     netInfo("Request " + p_tcp_request->uuid() + " successfully processed");
 }
 
-auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleHTTPRequest(std::shared_ptr< tristan::network::HttpRequest > p_http_request)
-    -> tristan::ResumableCoroutine {
+auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleHTTPRequest(std::shared_ptr< tristan::network::HttpRequest > p_http_request,
+                                                                                  std::shared_ptr< HttpPipeline > p_pipeline) -> tristan::ResumableCoroutine {
     netInfo("Starting processing of HTTP request " + p_http_request->uuid());
 
-    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_http_request);
-
-    tristan::sockets::InetSocket socket;
-
-    if (socket.error()) {
-        netError(socket.error().message());
-        p_http_request->request_handlers_api.setError(socket.error());
-        co_return;
-    }
+    //Whichever way the coroutine ends, requests left in the pipeline are not lost and the pipeline does not stay in the map.
+    struct PipelineGuard {
+        AsyncNetworkRequestHandlerImpl* m_handler;
+        std::shared_ptr< HttpPipeline > m_pipeline;
+        HttpPipelineKey m_pipeline_key;
 
-    p_http_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
-
-    socket.setHost(p_http_request->url().hostIP().as_int, p_http_request->url().host());
-    socket.setPort(p_http_request->url().portUint16_t_network_byte_order());
-    socket.setNonBlocking();
-    auto start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (not socket.connected()) {
-        if (p_http_request->isPaused()) {
-            netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
-            co_return;
-        }
-        if (p_http_request->isCanceled()) {
-            netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
-            co_return;
-        }
-        netInfo("Connecting to " + p_http_request->url().hostIP().as_string);
-        socket.connect(p_http_request->isSSL());
-
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-            co_return;
+        ~PipelineGuard() {
+            if (m_pipeline) {
+                m_handler->_abortHttpPipeline(m_pipeline_key, m_pipeline);
+            }
         }
-        co_await std::suspend_always();
-        socket.resetError();
-    }
+    } pipeline_guard{this,
+                     p_pipeline,
+                     {p_http_request->url().host(), p_http_request->url().portUint16_t_network_byte_order(), p_http_request->isSSL()}};
 
-    uint64_t bytes_written = 0;
-    uint64_t bytes_to_write = p_http_request->requestData().size();
-    p_http_request->request_handlers_api.setStatus(tristan::network::Status::WRITING);
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (bytes_written < bytes_to_write) {
-        if (p_http_request->isPaused()) {
-            netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+    //Host name is resolved in background and the reactor thread should not block on it.
+    auto resolve_deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(
+        p_http_request->connectTimeOut(), tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_http_request));
+    //Resolver thread makes the notifier readable, so the task is resumed by the reactor instead of polling the result.
+    std::shared_ptr< tristan::network::private_::EventNotifier > resolve_notifier;
+    while (not p_http_request->url().hostResolved()) {
+        if (p_http_request->isPaused() || p_http_request->isCanceled()) {
             co_return;
         }
-        if (p_http_request->isCanceled()) {
-            netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+        if (std::chrono::steady_clock::now() >= resolve_deadline) {
+            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
             co_return;
         }
-        netInfo("Writing to " + p_http_request->url().hostIP().as_string);
-        auto bytes_remain = bytes_to_write - bytes_written;
-        uint8_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-        bytes_written += socket.write(p_http_request->requestData(), current_frame_size, bytes_written);
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-            co_return;
+        if (not resolve_notifier) {
+            resolve_notifier = std::make_shared< tristan::network::private_::EventNotifier >();
+            if (not p_http_request->url().notifyWhenHostResolved([resolve_notifier]() -> void { resolve_notifier->notify(); })) {
+                continue;
+            }
         }
-        netDebug(std::to_string(current_frame_size) + " bytes was written");
-        co_await std::suspend_always();
-        socket.resetError();
+        static_cast< void >(co_await Reactor::waitFor(resolve_notifier->fd(), Reactor::Event::READ, resolve_deadline));
+    }
+    if (not tristan::network::private_::NetworkRequestHandlerImpl::checkHostResolved(p_http_request)) {
+        co_return;
     }
 
-    p_http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
+    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_http_request);
 
-    std::vector< uint8_t > headers_data;
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (true) {
-        if (p_http_request->isPaused()) {
-            netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
-            co_return;
-        }
-        if (p_http_request->isCanceled()) {
-            netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
-            co_return;
-        }
-        auto data = socket.readUntil({'\r', '\n', '\r', '\n'});
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-            co_return;
-        }
-        if (socket.error() && socket.error().value() != static_cast< int >(tristan::sockets::Error::READ_DONE)) {
-            if (not data.empty()) {
-                netDebug(std::to_string(data.size()) + " bytes was read");
-                netDebug("Data: " + std::string(data.begin(), data.end()));
-                headers_data.insert(headers_data.end(), data.begin(), data.end());
+    tristan::network::private_::ConnectionPool::Key connection_key{
+        p_http_request->url().host(), p_http_request->url().portUint16_t_network_byte_order(), p_http_request->isSSL()};
+    auto socket_ptr = tristan::network::private_::ConnectionPool::instance().acquire(connection_key);
+
+    p_http_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
+
+    auto total_deadline = tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_http_request);
+    auto deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->connectTimeOut(), total_deadline);
+    if (not socket_ptr) {
+        tristan::network::private_::ConnectionRace race(p_http_request->url().hostIPList(),
+                                                        p_http_request->url().portUint16_t_network_byte_order(),
+                                                        p_http_request->url().host(),
+                                                        p_http_request->isSSL());
+        while (not race.advance()) {
+            if (p_http_request->isPaused()) {
+                netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+                co_return;
             }
-            co_await std::suspend_always();
-            socket.resetError();
-            continue;
-        }
-        if (not data.empty()) {
-            netDebug(std::to_string(data.size()) + " bytes was read");
-            netDebug("Data: " + std::string(data.begin(), data.end()));
-            headers_data.insert(headers_data.end(), data.begin(), data.end());
-        }
-        p_http_request->initResponse(std::move(headers_data));
-        if (p_http_request->error()) {
-            netError(p_http_request->error().message());
-            co_return;
+            if (p_http_request->isCanceled()) {
+                netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+                co_return;
+            }
+            if (race.failed()) {
+                netError(race.error().message());
+                p_http_request->request_handlers_api.setError(race.error());
+                co_return;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                co_return;
+            }
+            //Wakes up either when one of the attempts is writable or when the next attempt is due.
+            static_cast< void >(co_await Reactor::waitForAny(race.readFds(), race.writeFds(), std::min(race.nextAttemptTime(), deadline)));
         }
-        break;
-    }
-
-    auto response = std::dynamic_pointer_cast< tristan::network::HttpResponse >(p_http_request->response());
-    if (not response) {
-        netFatal("Bad dynamic cast");
-        std::exit(1);
-    }
-    if (response->status() != tristan::network::HttpStatus::Ok) {
-        p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
-        co_return;
+        socket_ptr = race.winner();
     }
+    auto& socket = *socket_ptr;
 
-    if (auto content_length = response->headers()->headerValue(tristan::network::http::header_names::content_length)) {
-        p_http_request->setBytesToRead(std::stoll(content_length.value()));
-        netInfo("Content-length header found");
-        if (p_http_request->bytesToRead() != 0) {
-            socket.resetError();
-            p_http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
-            uint64_t bytes_read = 0;
-            uint64_t bytes_to_read = p_http_request->bytesToRead();
-            start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-            while (bytes_read < bytes_to_read) {
-                if (p_http_request->isPaused()) {
-                    netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+    std::vector< std::shared_ptr< tristan::network::HttpRequest > > write_queue;
+    std::shared_ptr< tristan::network::HttpResponse > response;
+    while (true) {
+        //With pipelining every request appended since the previous response is written before the next response is read.
+        write_queue.clear();
+        if (p_pipeline) {
+            p_pipeline->takeUnsent(write_queue);
+            p_http_request = p_pipeline->front();
+            if (not p_http_request) {
+                break;
+            }
+            total_deadline = tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_http_request);
+        } else {
+            write_queue.push_back(p_http_request);
+        }
+        for (const auto& http_request: write_queue) {
+            uint64_t bytes_written = 0;
+            auto request_buffers = http_request->requestBuffers();
+            uint64_t bytes_to_write = tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(request_buffers);
+            http_request->request_handlers_api.setStatus(tristan::network::Status::WRITING);
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(http_request->idleTimeOut(), total_deadline);
+            while (bytes_written < bytes_to_write) {
+                if (http_request->isPaused()) {
+                    netInfo("Network request is paused http_request->uuid() = " + http_request->uuid());
                     co_return;
                 }
-                if (p_http_request->isCanceled()) {
-                    netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+                if (http_request->isCanceled()) {
+                    netInfo("Network request is cancelled http_request->uuid() = " + http_request->uuid());
                     co_return;
                 }
-                auto bytes_remain = bytes_to_read - bytes_read;
-                uint8_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-
-                auto data = socket.read(current_frame_size);
-                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+                netInfo("Writing to " + http_request->url().hostIP().as_string);
+                auto bytes_remain = bytes_to_write - bytes_written;
+                uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(http_request), bytes_remain);
+                auto frame_bytes_written = socket.writev(request_buffers, current_frame_size, bytes_written);
+                if (frame_bytes_written != 0) {
+                    bytes_written += frame_bytes_written;
+                    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(http_request->idleTimeOut(), total_deadline);
+                }
+                if (p_pipeline && p_pipeline->answered() != 0 && tristan::network::private_::NetworkRequestHandlerImpl::connectionLost(socket)) {
+                    netWarning("Pipelined connection to " + http_request->url().hostIP().as_string + " was closed");
                     co_return;
                 }
-                if (not data.empty()) {
-                    netDebug(std::to_string(data.size()) + " bytes was read from " + p_http_request->url().hostIP().as_string);
-                    bytes_read += data.size();
-                    p_http_request->request_handlers_api.addResponseData(std::move(data));
-                    if (p_http_request->error()) {
-                        netError(p_http_request->error().message());
-                        co_return;
-                    }
+                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, http_request)) {
+                    co_return;
                 }
+                netDebug(std::to_string(current_frame_size) + " bytes was written");
                 if (socket.error()) {
+                    if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::WRITE, deadline)) {
+                        tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(http_request);
+                        co_return;
+                    }
+                } else {
                     co_await std::suspend_always();
-                    socket.resetError();
                 }
+                socket.resetError();
             }
-        } else {
-            netWarning("Content length header contained 0 value");
-            p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
-        }
-    } else if (auto transfer_encoding = response->headers()->headerValue(tristan::network::http::header_names::transfer_encoding)) {
-        netInfo("Transfer-encoding header found");
-        if (transfer_encoding.value().find("chunked") == std::string::npos) {
-            netWarning("Transfer-encoding header does not contain chunked specification.");
-            p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
-            co_return;
+            if (const auto& body_file = http_request->bodyFile()) {
+                tristan::network::private_::FileBodySender body_sender(socket, body_file.value());
+                while (not body_sender.done()) {
+                    if (http_request->isPaused()) {
+                        netInfo("Network request is paused http_request->uuid() = " + http_request->uuid());
+                        co_return;
+                    }
+                    if (http_request->isCanceled()) {
+                        netInfo("Network request is cancelled http_request->uuid() = " + http_request->uuid());
+                        co_return;
+                    }
+                    auto frame_bytes_sent = body_sender.send(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(http_request));
+                    if (body_sender.error()) {
+                        netError(body_sender.error().message());
+                        http_request->request_handlers_api.setError(body_sender.error());
+                        co_return;
+                    }
+                    if (frame_bytes_sent != 0) {
+                        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(http_request->idleTimeOut(), total_deadline);
+                        netDebug(std::to_string(frame_bytes_sent) + " bytes of body file was sent");
+                    }
+                    if (std::chrono::steady_clock::now() >= deadline) {
+                        tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(http_request);
+                        co_return;
+                    }
+                    if (body_sender.wouldBlock()) {
+                        if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::WRITE, deadline)) {
+                            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(http_request);
+                            co_return;
+                        }
+                    } else {
+                        co_await std::suspend_always();
+                    }
+                }
+            }
+            http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
         }
+
+        bool reusable = false;
+        tristan::network::HttpResponseParser response_parser;
+        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->firstByteTimeOut(), total_deadline);
         while (true) {
             if (p_http_request->isPaused()) {
                 netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
@@ -295,24 +381,135 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleHTTPReque
                 netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
                 co_return;
             }
-            auto chunk_size = socket.readUntil({'\r', '\n'});
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+            auto data = socket.readUntil({'\r', '\n', '\r', '\n'});
+            //Server may close persistent connection at any time. Requests it did not answer are sent again on another connection.
+            if (p_pipeline && p_pipeline->answered() != 0 && response_parser.data().empty() && data.empty()
+                && tristan::network::private_::NetworkRequestHandlerImpl::connectionLost(socket)) {
+                netWarning("Pipelined connection to " + p_http_request->url().hostIP().as_string + " was closed");
+                co_return;
+            }
+            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
                 co_return;
             }
             if (socket.error() && socket.error().value() != static_cast< int >(tristan::sockets::Error::READ_DONE)) {
-                co_await std::suspend_always();
+                if (not data.empty()) {
+                    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                    netDebug(std::to_string(data.size()) + " bytes was read");
+                    netDebug("Data: " + std::string(data.begin(), data.end()));
+                    static_cast< void >(response_parser.consume(data));
+                    if (response_parser.failed()) {
+                        netError(response_parser.error().message());
+                        p_http_request->request_handlers_api.setError(response_parser.error());
+                        co_return;
+                    }
+                }
+                if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::READ, deadline)) {
+                    tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                    co_return;
+                }
                 socket.resetError();
                 continue;
             }
-            auto pos = std::find(chunk_size.begin(), chunk_size.end(), ';');
-            uint64_t bytes_to_read = std::stoll(std::string(chunk_size.begin(), pos), nullptr, 16);
-            if (bytes_to_read == 0) {
-                break;
+            if (not data.empty()) {
+                netDebug(std::to_string(data.size()) + " bytes was read");
+                netDebug("Data: " + std::string(data.begin(), data.end()));
+                static_cast< void >(response_parser.consume(data));
+                if (response_parser.failed()) {
+                    netError(response_parser.error().message());
+                    p_http_request->request_handlers_api.setError(response_parser.error());
+                    co_return;
+                }
+            }
+            p_http_request->initResponse(response_parser);
+            if (p_http_request->error()) {
+                netError(p_http_request->error().message());
+                co_return;
             }
+            break;
+        }
+
+        response = std::dynamic_pointer_cast< tristan::network::HttpResponse >(p_http_request->response());
+        if (not response) {
+            netFatal("Bad dynamic cast");
+            std::exit(1);
+        }
+        //TLS 1.3 session tickets are sent after the handshake, hence the session is stored once the server responded.
+        if (p_http_request->isSSL()) {
+            tristan::network::private_::TlsSessionCache::instance().store(
+                p_http_request->url().host(), p_http_request->url().portUint16_t_network_byte_order(), socket);
+        }
+        if (response->status() != tristan::network::HttpStatus::Ok) {
+            p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
+            co_return;
+        }
+
+        if (auto content_length = response->headers()->value(tristan::network::http::HeaderId::CONTENT_LENGTH)) {
+            uint64_t content_length_value = 0;
+            const auto* content_length_end = content_length->data() + content_length->size();
+            auto result = std::from_chars(content_length->data(), content_length_end, content_length_value);
+            if (result.ec != std::errc() || result.ptr != content_length_end) {
+                //Body size is unknown, hence the connection is not reused since unread body would be taken for the next response.
+                netError("Bad Content-Length header value: " + std::string(content_length.value()));
+                p_http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR));
+                co_return;
+            }
+            p_http_request->setBytesToRead(content_length_value);
+            netInfo("Content-length header found");
+            if (p_http_request->bytesToRead() != 0) {
+                socket.resetError();
+                p_http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
+                p_http_request->request_handlers_api.reserveResponseData(p_http_request->bytesToRead());
+                uint64_t bytes_read = 0;
+                uint64_t bytes_to_read = p_http_request->bytesToRead();
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                while (bytes_read < bytes_to_read) {
+                    if (p_http_request->isPaused()) {
+                        netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+                        co_return;
+                    }
+                    if (p_http_request->isCanceled()) {
+                        netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+                        co_return;
+                    }
+                    auto bytes_remain = bytes_to_read - bytes_read;
+                    uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_http_request), bytes_remain);
+
+                    auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readResponseData(socket, p_http_request, current_frame_size);
+                    if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
+                        co_return;
+                    }
+                    if (frame_bytes_read != 0) {
+                        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                        netDebug(std::to_string(frame_bytes_read) + " bytes was read from " + p_http_request->url().hostIP().as_string);
+                        bytes_read += frame_bytes_read;
+                        if (p_http_request->error()) {
+                            netError(p_http_request->error().message());
+                            co_return;
+                        }
+                    }
+                    if (socket.error()) {
+                        if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::READ, deadline)) {
+                            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                            co_return;
+                        }
+                        socket.resetError();
+                    }
+                }
+            } else {
+                netWarning("Content length header contained 0 value");
+            }
+            reusable = true;
+        } else if (auto transfer_encoding = response->headers()->value(tristan::network::http::HeaderId::TRANSFER_ENCODING)) {
+            netInfo("Transfer-encoding header found");
+            if (transfer_encoding.value().find("chunked") == std::string::npos) {
+                netWarning("Transfer-encoding header does not contain chunked specification.");
+                p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
+                co_return;
+            }
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
             socket.resetError();
-            uint64_t bytes_read = 0;
-            start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-            while (bytes_read < bytes_to_read) {
+            tristan::network::HttpChunkedDecoder chunked_decoder;
+            while (not chunked_decoder.done()) {
                 if (p_http_request->isPaused()) {
                     netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
                     co_return;
@@ -321,41 +518,53 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleHTTPReque
                     netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
                     co_return;
                 }
-                auto bytes_remain = bytes_to_read - bytes_read;
-                uint8_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-                auto data = socket.read(current_frame_size);
-                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+                auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readChunkedResponseData(
+                    socket, p_http_request, chunked_decoder, tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_http_request));
+                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
                     co_return;
                 }
-                if (not data.empty()) {
-                    netDebug(std::to_string(data.size()) + " bytes was read from " + p_http_request->url().hostIP().as_string);
-                    bytes_read += data.size();
-                    p_http_request->request_handlers_api.addResponseData(std::move(data));
+                if (frame_bytes_read != 0) {
+                    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                    netDebug(std::to_string(frame_bytes_read) + " bytes was read from " + p_http_request->url().hostIP().as_string);
                     if (p_http_request->error()) {
                         netError(p_http_request->error().message());
                         co_return;
                     }
                 }
                 if (socket.error()) {
-                    co_await std::suspend_always();
+                    if (not co_await Reactor::waitFor(socket.fd(), Reactor::Event::READ, deadline)) {
+                        tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                        co_return;
+                    }
                     socket.resetError();
                 }
             }
-            auto redundant_data = socket.read(2);
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-                co_return;
-            }
-            if (socket.error()) {
-                co_await std::suspend_always();
-                socket.resetError();
-            }
+            tristan::network::private_::NetworkRequestHandlerImpl::addTrailers(*response, chunked_decoder);
+            reusable = true;
+        } else {
+            p_http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR));
+            co_return;
         }
-    } else {
-        p_http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR));
-        co_return;
+        p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
+        netInfo("Request " + p_http_request->uuid() + " successfully processed");
+        if (not reusable) {
+            co_return;
+        }
+        if (not p_pipeline) {
+            break;
+        }
+        p_pipeline->pop();
     }
-    p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
-    netInfo("Request " + p_http_request->uuid() + " successfully processed");
+    if (response) {
+        tristan::network::private_::ConnectionPool::instance().release(connection_key, std::move(socket_ptr), *response);
+    }
+}
+
+auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handlePipelinedHttpRequest(//NOLINT
+    std::shared_ptr< tristan::network::HttpRequest > p_http_request) -> tristan::ResumableCoroutine {
+    //The request is written and read by the coroutine which owns the pipeline.
+    netInfo("HTTP request " + p_http_request->uuid() + " was appended to the pipeline");
+    co_return;
 }
 
 auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleUnimplementedRequest(//NOLINT
@@ -366,3 +575,29 @@ auto tristan::network::private_::AsyncNetworkRequestHandlerImpl::handleUnimpleme
     p_network_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::ErrorCode::REQUEST_NOT_SUPPORTED));
     co_return;
 }
+
+void tristan::network::private_::AsyncNetworkRequestHandlerImpl::_abortHttpPipeline(const HttpPipelineKey& p_pipeline_key,
+                                                                                    const std::shared_ptr< HttpPipeline >& p_pipeline) {
+    auto http_requests = p_pipeline->close();
+    {
+        std::scoped_lock< std::mutex > lock(m_http_pipelines_lock);
+        //Closed pipeline may have been replaced already by the one which was started for the following request.
+        auto pipeline = m_http_pipelines.find(p_pipeline_key);
+        if (pipeline != m_http_pipelines.end() && pipeline->second == p_pipeline) {
+            m_http_pipelines.erase(pipeline);
+        }
+    }
+    for (auto& http_request: http_requests) {
+        if (http_request->error() || http_request->isPaused() || http_request->isCanceled()
+            || http_request->status() == tristan::network::Status::DONE) {
+            continue;
+        }
+        if (not m_requeue_function) {
+            http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::ErrorCode::REQUEST_HANDLER_STOPPED));
+            continue;
+        }
+        netInfo("Requeuing HTTP request " + http_request->uuid());
+        http_request->request_handlers_api.setStatus(tristan::network::Status::WAITING);
+        m_requeue_function(std::move(http_request));
+    }
+}
@@ -1,16 +1,23 @@
 #include "async_request_handler.hpp"
 #include "async_network_request_handler_impl.hpp"
+#include "reactor.hpp"
 #include "network_error.hpp"
 #include "network_logger.hpp"
 #include "http_response.hpp"
 
-#include <resumable_coroutine.hpp>
-
-#include <thread>
-
 tristan::network::private_::AsyncRequestHandler::AsyncRequestHandler() :
-    m_max_processed_requests_count(50),
-    m_working(false) { }
+    m_reactor(std::make_unique< tristan::network::private_::Reactor >()),
+    m_request_handler(std::make_unique< tristan::network::private_::AsyncNetworkRequestHandlerImpl >()),
+    m_pending_requests_count(0),
+    m_requests_count(0),
+    m_next_sibling(0),
+    m_working(true),
+    m_idle(false) {
+    //Requests left unanswered by closed pipelined connection are resent on their own connections.
+    m_request_handler->setRequeueFunction([this](std::shared_ptr< NetworkRequestBase >&& p_network_request) -> void {
+        tristan::network::private_::AsyncRequestHandler::_submit(std::move(p_network_request), false);
+    });
+}
 
 tristan::network::private_::AsyncRequestHandler::~AsyncRequestHandler() = default;
 
@@ -18,47 +25,177 @@ auto tristan::network::private_::AsyncRequestHandler::create() -> std::unique_pt
     return std::unique_ptr< AsyncRequestHandler >(new AsyncRequestHandler());
 }
 
-void tristan::network::private_::AsyncRequestHandler::setMaxDownloadsCount(uint8_t p_count) { m_max_processed_requests_count = p_count; }
+void tristan::network::private_::AsyncRequestHandler::setSiblings(std::vector< AsyncRequestHandler* > p_siblings) { m_siblings = std::move(p_siblings); }
 
-void tristan::network::private_::AsyncRequestHandler::stop() { m_working.store(false, std::memory_order_relaxed); }
+void tristan::network::private_::AsyncRequestHandler::setHttpPipeliningDepth(uint8_t p_depth) { m_request_handler->setHttpPipeliningDepth(p_depth); }
+
+void tristan::network::private_::AsyncRequestHandler::stop() {
+    m_working.store(false, std::memory_order_relaxed);
+    m_reactor->wake();
+}
+
+auto tristan::network::private_::AsyncRequestHandler::load() const noexcept -> size_t { return m_requests_count.load(std::memory_order_relaxed); }
 
 void tristan::network::private_::AsyncRequestHandler::run() {
     netInfo("Starting async request handler");
-    if (not m_request_handler){
-        m_request_handler = std::make_unique< tristan::network::private_::AsyncNetworkRequestHandlerImpl >();
+    if (m_reactor->error()) {
+        netFatal("Async request handler could not be started: " + m_reactor->error().message());
+        m_working.store(false, std::memory_order_relaxed);
+        return;
     }
-    m_working.store(true, std::memory_order_relaxed);
+    tristan::network::private_::Reactor::setCurrent(m_reactor.get());
 
+    std::vector< AsyncTask* > yielded_requests;
     while (m_working) {
-        if (m_processed_requests.empty()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        } else {
-            uint8_t active_requests_counter = 0;
-            for (auto active_requests_iterator = m_processed_requests.begin(); active_requests_iterator != m_processed_requests.end();) {
-                if (active_requests_counter > m_max_processed_requests_count) {
-                    continue;
-                    netInfo("Maximum async requests number is reached");
-                }
-                if (not active_requests_iterator->resume()) {
-                    std::scoped_lock< std::mutex > lock(m_processed_requests_lock);
-                    active_requests_iterator = m_processed_requests.erase(active_requests_iterator);
-                    --active_requests_counter;
-                } else {
-                    ++active_requests_iterator;
-                    ++active_requests_counter;
-                }
+        tristan::network::private_::AsyncRequestHandler::_releaseFinishedRequests();
+        tristan::network::private_::AsyncRequestHandler::_admitPendingRequests();
+        //Tasks which yielded are pushed back only after the batch, otherwise LIFO pop would starve the rest of the deque.
+        while (auto* task = tristan::network::private_::AsyncRequestHandler::_popReady()) {
+            tristan::network::private_::AsyncRequestHandler::_resume(task, yielded_requests);
+        }
+        if (yielded_requests.empty()) {
+            if (auto* task = tristan::network::private_::AsyncRequestHandler::_steal()) {
+                tristan::network::private_::AsyncRequestHandler::_resume(task, yielded_requests);
             }
         }
+        for (auto* task: yielded_requests) {
+            tristan::network::private_::AsyncRequestHandler::_pushReady(task);
+        }
+        yielded_requests.clear();
+        //Tasks which yielded without waiting for the socket must be resumed without blocking in epoll.
+        //Otherwise the loop sleeps until a socket is ready, a timer expires or addRequest(), stop() or a sibling wakes the reactor.
+        auto block = m_ready_requests.size() == 0 && m_ready_requests_overflow.empty();
+        m_idle.store(block, std::memory_order_relaxed);
+        m_reactor->poll(block, m_polled_requests);
+        m_idle.store(false, std::memory_order_relaxed);
+        for (auto* task: m_polled_requests) {
+            tristan::network::private_::AsyncRequestHandler::_pushReady(task);
+        }
+        m_polled_requests.clear();
+        if (m_ready_requests.size() > 1) {
+            tristan::network::private_::AsyncRequestHandler::_wakeIdleSibling();
+        }
     }
+    tristan::network::private_::Reactor::setCurrent(nullptr);
     netInfo("Async request handler stopped");
 }
 
 void tristan::network::private_::AsyncRequestHandler::addRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request) {
+    tristan::network::private_::AsyncRequestHandler::_submit(std::move(p_network_request), true);
+}
+
+void tristan::network::private_::AsyncRequestHandler::_submit(std::shared_ptr< NetworkRequestBase >&& p_network_request, bool p_pipelining_allowed) {
     if (not m_working) {
         p_network_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::ErrorCode::ASYNC_NETWORK_REQUEST_HANDLER_WAS_NOT_LUNCHED));
         return;
     }
-    std::scoped_lock< std::mutex > lock(m_processed_requests_lock);
+    auto task = std::make_unique< tristan::network::private_::AsyncTask >(m_request_handler->handleRequest(std::move(p_network_request), p_pipelining_allowed));
+    task->m_owner = this;
+    if (not m_submitted_requests.push(std::move(task))) {
+        std::scoped_lock< std::mutex > lock(m_pending_requests_lock);
+        m_pending_requests.emplace_back(std::move(task));
+        m_pending_requests_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_requests_count.fetch_add(1, std::memory_order_relaxed);
+    m_reactor->wake();
+}
+
+void tristan::network::private_::AsyncRequestHandler::_admitPendingRequests() {
+    std::unique_ptr< AsyncTask > task;
+    while (m_submitted_requests.pop(task)) {
+        m_processed_requests.emplace_back(std::move(task));
+        auto position = std::prev(m_processed_requests.end());
+        position->get()->m_position = position;
+        tristan::network::private_::AsyncRequestHandler::_pushReady(position->get());
+    }
+    if (m_pending_requests_count.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    std::scoped_lock< std::mutex > lock(m_pending_requests_lock);
+    while (not m_pending_requests.empty()) {
+        m_processed_requests.splice(m_processed_requests.end(), m_pending_requests, m_pending_requests.begin());
+        m_pending_requests_count.fetch_sub(1, std::memory_order_relaxed);
+        auto position = std::prev(m_processed_requests.end());
+        position->get()->m_position = position;
+        tristan::network::private_::AsyncRequestHandler::_pushReady(position->get());
+    }
+}
+
+void tristan::network::private_::AsyncRequestHandler::_releaseFinishedRequests() {
+    std::vector< AsyncTask* > finished_requests;
+    {
+        std::scoped_lock< std::mutex > lock(m_finished_requests_lock);
+        finished_requests.swap(m_finished_requests);
+    }
+    for (auto* task: finished_requests) {
+        tristan::network::private_::AsyncRequestHandler::_finish(task);
+    }
+}
 
-    m_processed_requests.emplace_back(m_request_handler->handleRequest(std::move(p_network_request)));
+void tristan::network::private_::AsyncRequestHandler::_pushReady(AsyncTask* p_task) {
+    if (not m_ready_requests.push(p_task)) {
+        m_ready_requests_overflow.push_back(p_task);
+    }
+}
+
+auto tristan::network::private_::AsyncRequestHandler::_popReady() -> AsyncTask* {
+    if (auto* task = m_ready_requests.pop()) {
+        return task;
+    }
+    if (m_ready_requests_overflow.empty()) {
+        return nullptr;
+    }
+    auto* task = m_ready_requests_overflow.back();
+    m_ready_requests_overflow.pop_back();
+    return task;
+}
+
+auto tristan::network::private_::AsyncRequestHandler::_steal() -> AsyncTask* {
+    for (size_t attempt = 0; attempt < m_siblings.size(); ++attempt) {
+        auto* sibling = m_siblings.at(m_next_sibling % m_siblings.size());
+        ++m_next_sibling;
+        if (auto* task = sibling->m_ready_requests.steal()) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void tristan::network::private_::AsyncRequestHandler::_wakeIdleSibling() {
+    for (auto* sibling: m_siblings) {
+        if (sibling->m_idle.load(std::memory_order_relaxed)) {
+            sibling->m_reactor->wake();
+            return;
+        }
+    }
+}
+
+void tristan::network::private_::AsyncRequestHandler::_resume(AsyncTask* p_task, std::vector< AsyncTask* >& p_yielded_tasks) {
+    m_reactor->setCurrentTask(p_task);
+    auto active = p_task->m_coroutine.resume();
+    m_reactor->setCurrentTask(nullptr);
+    if (not active) {
+        if (p_task->m_owner == this) {
+            tristan::network::private_::AsyncRequestHandler::_finish(p_task);
+        } else {
+            p_task->m_owner->_retire(p_task);
+        }
+        return;
+    }
+    if (not p_task->m_waiting) {
+        p_yielded_tasks.push_back(p_task);
+    }
+}
+
+void tristan::network::private_::AsyncRequestHandler::_finish(AsyncTask* p_task) {
+    m_processed_requests.erase(p_task->m_position);
+    m_requests_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void tristan::network::private_::AsyncRequestHandler::_retire(AsyncTask* p_task) {
+    {
+        std::scoped_lock< std::mutex > lock(m_finished_requests_lock);
+        m_finished_requests.push_back(p_task);
+    }
+    m_reactor->wake();
 }
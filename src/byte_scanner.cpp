@@ -0,0 +1,89 @@
+#include "byte_scanner.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  #define TRISTAN_NETWORK_X86_SIMD
+  #include <immintrin.h>
+#endif
+
+namespace {
+
+    using FindByteFunction = const uint8_t* (*)(const uint8_t*, const uint8_t*, uint8_t) noexcept;
+
+    auto findByteScalar(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t* {
+        for (; p_begin != p_end; ++p_begin) {
+            if (*p_begin == p_byte) {
+                return p_begin;
+            }
+        }
+        return p_end;
+    }
+
+#if defined(TRISTAN_NETWORK_X86_SIMD)
+    //SSE2 is a part of x86-64 baseline, so it needs no runtime check.
+    auto findByteSse2(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t* {
+        const auto needle = _mm_set1_epi8(static_cast< char >(p_byte));
+        while (p_end - p_begin >= 16) {
+            auto block = _mm_loadu_si128(reinterpret_cast< const __m128i* >(p_begin));
+            auto mask = static_cast< uint32_t >(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+            if (mask != 0) {
+                return p_begin + __builtin_ctz(mask);
+            }
+            p_begin += 16;
+        }
+        return findByteScalar(p_begin, p_end, p_byte);
+    }
+
+    [[gnu::target("avx2")]] auto findByteAvx2(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t* {
+        const auto needle = _mm256_set1_epi8(static_cast< char >(p_byte));
+        while (p_end - p_begin >= 32) {
+            auto block = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(p_begin));
+            auto mask = static_cast< uint32_t >(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+            if (mask != 0) {
+                return p_begin + __builtin_ctz(mask);
+            }
+            p_begin += 32;
+        }
+        return findByteSse2(p_begin, p_end, p_byte);
+    }
+#endif
+
+    auto selectFindByte() noexcept -> FindByteFunction {
+#if defined(TRISTAN_NETWORK_X86_SIMD)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return findByteAvx2;
+        }
+        return findByteSse2;
+#else
+        return findByteScalar;
+#endif
+    }
+
+}  //End of unnamed namespace
+
+auto tristan::network::private_::findByte(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t* {
+    static const FindByteFunction find_byte = selectFindByte();
+    return find_byte(p_begin, p_end, p_byte);
+}
+
+auto tristan::network::private_::findSequence(const uint8_t* p_begin, const uint8_t* p_end, std::span< const uint8_t > p_sequence) noexcept
+    -> const uint8_t* {
+    if (static_cast< size_t >(p_end - p_begin) < p_sequence.size()) {
+        return p_end;
+    }
+    //Candidates are located by the first byte, the rest is compared only for them.
+    const auto* last_candidate = p_end - p_sequence.size();
+    while (p_begin <= last_candidate) {
+        p_begin = tristan::network::private_::findByte(p_begin, last_candidate + 1, p_sequence.front());
+        if (p_begin > last_candidate) {
+            break;
+        }
+        if (std::memcmp(p_begin + 1, p_sequence.data() + 1, p_sequence.size() - 1) == 0) {
+            return p_begin;
+        }
+        ++p_begin;
+    }
+    return p_end;
+}
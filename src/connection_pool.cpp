@@ -0,0 +1,145 @@
+#include "connection_pool.hpp"
+#include "http_header_names.hpp"
+#include "network_logger.hpp"
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+namespace {
+
+    [[nodiscard]] auto containsToken(std::string_view p_value, std::string_view p_token) -> bool {
+        auto found = std::search(p_value.begin(), p_value.end(), p_token.begin(), p_token.end(), [](char p_left, char p_right) -> bool {
+            return std::tolower(static_cast< unsigned char >(p_left)) == p_right;
+        });
+        return found != p_value.end();
+    }
+
+}  //End of unnamed namespace
+
+tristan::network::private_::ConnectionPool::ConnectionPool() :
+    m_idle_timeout(std::chrono::seconds(30)),
+    m_max_idle_connections_per_host(6) { }
+
+auto tristan::network::private_::ConnectionPool::instance() -> ConnectionPool& {
+    static ConnectionPool connection_pool;
+
+    return connection_pool;
+}
+
+void tristan::network::private_::ConnectionPool::setMaxIdleConnectionsPerHost(uint8_t p_count) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_max_idle_connections_per_host = p_count;
+    for (auto& [key, connections]: m_connections) {
+        while (connections.size() > m_max_idle_connections_per_host) {
+            connections.pop_front();
+        }
+    }
+}
+
+void tristan::network::private_::ConnectionPool::setIdleTimeOut(std::chrono::milliseconds p_timeout) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_idle_timeout = p_timeout;
+}
+
+auto tristan::network::private_::ConnectionPool::acquire(const Key& p_key) -> std::unique_ptr< tristan::sockets::InetSocket > {
+    std::unique_ptr< tristan::sockets::InetSocket > socket;
+    std::scoped_lock< std::mutex > lock(m_lock);
+    tristan::network::private_::ConnectionPool::_evictExpired(std::chrono::steady_clock::now());
+    auto connections_iterator = m_connections.find(p_key);
+    if (connections_iterator == m_connections.end()) {
+        return nullptr;
+    }
+    auto& connections = connections_iterator->second;
+    //The most recently used connection is the least likely to be closed by the server.
+    while (not connections.empty()) {
+        socket = std::move(connections.back().m_socket);
+        connections.pop_back();
+        if (tristan::network::private_::ConnectionPool::_alive(*socket)) {
+            netDebug("Reusing connection to port " + std::to_string(p_key.m_port));
+            break;
+        }
+        socket.reset();
+    }
+    if (connections.empty()) {
+        m_connections.erase(connections_iterator);
+    }
+    return socket;
+}
+
+void tristan::network::private_::ConnectionPool::release(const Key& p_key,
+                                                         std::unique_ptr< tristan::sockets::InetSocket >&& p_socket,
+                                                         const HttpResponse& p_response) {
+    auto keep_alive_timeout = tristan::network::private_::ConnectionPool::_keepAliveTimeOut(p_response);
+    if (not keep_alive_timeout || not p_socket->connected() || p_socket->error()) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (m_max_idle_connections_per_host == 0) {
+        return;
+    }
+    auto& connections = m_connections[p_key];
+    if (connections.size() >= m_max_idle_connections_per_host) {
+        connections.pop_front();
+    }
+    connections.push_back({std::move(p_socket), now + std::min(keep_alive_timeout.value(), m_idle_timeout)});
+}
+
+void tristan::network::private_::ConnectionPool::clear() {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_connections.clear();
+}
+
+auto tristan::network::private_::ConnectionPool::_keepAliveTimeOut(const HttpResponse& p_response) const -> std::optional< std::chrono::milliseconds > {
+    if (not p_response.headers()) {
+        return std::nullopt;
+    }
+    auto connection = p_response.headers()->value(tristan::network::http::HeaderId::CONNECTION);
+    if (connection && containsToken(connection.value(), "close")) {
+        return std::nullopt;
+    }
+    //HTTP/1.0 connection is persistent only if the server explicitly agreed to keep it alive.
+    if (p_response.minorVersion() == 0 && not(connection && containsToken(connection.value(), "keep-alive"))) {
+        return std::nullopt;
+    }
+    //Keep-Alive: timeout=5, max=100
+    if (auto keep_alive = p_response.headers()->value(tristan::network::http::HeaderId::KEEP_ALIVE)) {
+        auto timeout_position = keep_alive->find("timeout=");
+        if (timeout_position != std::string_view::npos) {
+            int64_t seconds = 0;
+            auto result = std::from_chars(keep_alive->data() + timeout_position + 8, keep_alive->data() + keep_alive->size(), seconds);
+            if (result.ec == std::errc()) {
+                //Server closes the connection exactly at timeout, so the connection is not reused during the last second.
+                return std::max(std::chrono::milliseconds(std::chrono::seconds(seconds)) - std::chrono::seconds(1), std::chrono::milliseconds(0));
+            }
+            netWarning("Bad Keep-Alive header value: " + std::string(keep_alive.value()));
+        }
+    }
+    return m_idle_timeout;
+}
+
+auto tristan::network::private_::ConnectionPool::_alive(const tristan::sockets::InetSocket& p_socket) -> bool {
+    if (not p_socket.connected()) {
+        return false;
+    }
+    uint8_t byte;
+    auto result = recv(p_socket.fd(), &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+void tristan::network::private_::ConnectionPool::_evictExpired(std::chrono::steady_clock::time_point p_now) {
+    for (auto connections_iterator = m_connections.begin(); connections_iterator != m_connections.end();) {
+        auto& connections = connections_iterator->second;
+        while (not connections.empty() && connections.front().m_expiry <= p_now) {
+            connections.pop_front();
+        }
+        if (connections.empty()) {
+            connections_iterator = m_connections.erase(connections_iterator);
+        } else {
+            ++connections_iterator;
+        }
+    }
+}
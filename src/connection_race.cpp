@@ -0,0 +1,165 @@
+#include "connection_race.hpp"
+#include "tls_session_cache.hpp"
+#include "network_logger.hpp"
+
+#include <socket_error.hpp>
+
+#include <atomic>
+#include <algorithm>
+
+namespace {
+
+    std::atomic< std::chrono::milliseconds > g_attempt_delay(std::chrono::milliseconds(250));
+
+}  //End of unnamed namespace
+
+tristan::network::private_::ConnectionRace::ConnectionRace(const std::vector< IP >& p_addresses, uint16_t p_port, const std::string& p_host, bool p_ssl) :
+    m_host(p_host),
+    m_next_attempt_time(std::chrono::steady_clock::time_point::min()),
+    m_next_address(0),
+    m_port(p_port),
+    m_ssl(p_ssl) {
+    //Families are interleaved starting with IPv6, so that broken connectivity of one family costs a single attempt delay.
+    std::vector< IP > ipv4_addresses;
+    std::vector< IP > ipv6_addresses;
+    for (const auto& address: p_addresses) {
+        if (address.is_ipv6) {
+            ipv6_addresses.push_back(address);
+        } else {
+            ipv4_addresses.push_back(address);
+        }
+    }
+    m_addresses.reserve(p_addresses.size());
+    for (size_t index = 0; index < std::max(ipv4_addresses.size(), ipv6_addresses.size()); ++index) {
+        if (index < ipv6_addresses.size()) {
+            m_addresses.push_back(std::move(ipv6_addresses.at(index)));
+        }
+        if (index < ipv4_addresses.size()) {
+            m_addresses.push_back(std::move(ipv4_addresses.at(index)));
+        }
+    }
+}
+
+void tristan::network::private_::ConnectionRace::setAttemptDelay(std::chrono::milliseconds p_delay) { g_attempt_delay.store(p_delay, std::memory_order_relaxed); }
+
+auto tristan::network::private_::ConnectionRace::advance() -> bool {
+    auto now = std::chrono::steady_clock::now();
+    if (m_next_address < m_addresses.size() && (m_attempts.empty() || now >= m_next_attempt_time)) {
+        tristan::network::private_::ConnectionRace::_startAttempt(now);
+    }
+    for (size_t index = 0; index < m_attempts.size();) {
+        auto& socket = *m_attempts.at(index);
+        if (not socket.error()) {
+            socket.connect(m_ssl);
+        }
+        if (socket.connected()) {
+            netInfo("Connected to " + m_host);
+            m_winner = std::move(m_attempts.at(index));
+            //Losers are closed by their destructors.
+            tristan::network::private_::ConnectionRace::_clearAttempts();
+            return true;
+        }
+        if (socket.error() && not tristan::network::private_::ConnectionRace::_inProgress(socket.error())) {
+            netWarning("Connection attempt to " + m_host + " failed: " + socket.error().message());
+            m_error = socket.error();
+            m_attempts.erase(m_attempts.begin() + static_cast< std::ptrdiff_t >(index));
+            m_want_read.erase(m_want_read.begin() + static_cast< std::ptrdiff_t >(index));
+            //Failed attempt makes the next one due immediately.
+            m_next_attempt_time = now;
+            continue;
+        }
+        //Kind of the pending operation is only known from the error, hence it is saved before the reset.
+        m_want_read.at(index) = tristan::network::private_::ConnectionRace::_wantRead(socket.error());
+        socket.resetError();
+        ++index;
+    }
+    while (m_attempts.empty() && m_next_address < m_addresses.size()) {
+        tristan::network::private_::ConnectionRace::_startAttempt(now);
+        if (not m_attempts.empty() && m_attempts.back()->connected()) {
+            m_winner = std::move(m_attempts.back());
+            tristan::network::private_::ConnectionRace::_clearAttempts();
+            return true;
+        }
+    }
+    m_read_fds.clear();
+    m_write_fds.clear();
+    for (size_t index = 0; index < m_attempts.size(); ++index) {
+        if (m_want_read.at(index)) {
+            m_read_fds.push_back(m_attempts.at(index)->fd());
+        } else {
+            m_write_fds.push_back(m_attempts.at(index)->fd());
+        }
+    }
+    return false;
+}
+
+auto tristan::network::private_::ConnectionRace::winner() -> std::unique_ptr< tristan::sockets::InetSocket > { return std::move(m_winner); }
+
+auto tristan::network::private_::ConnectionRace::readFds() const noexcept -> const std::vector< int >& { return m_read_fds; }
+
+auto tristan::network::private_::ConnectionRace::writeFds() const noexcept -> const std::vector< int >& { return m_write_fds; }
+
+auto tristan::network::private_::ConnectionRace::nextAttemptTime() const noexcept -> std::chrono::steady_clock::time_point {
+    if (m_next_address >= m_addresses.size()) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return m_next_attempt_time;
+}
+
+auto tristan::network::private_::ConnectionRace::failed() const noexcept -> bool {
+    return not m_winner && m_attempts.empty() && m_next_address >= m_addresses.size();
+}
+
+auto tristan::network::private_::ConnectionRace::error() const noexcept -> const std::error_code& { return m_error; }
+
+void tristan::network::private_::ConnectionRace::_startAttempt(std::chrono::steady_clock::time_point p_now) {
+    const auto& address = m_addresses.at(m_next_address);
+    ++m_next_address;
+    m_next_attempt_time = p_now + g_attempt_delay.load(std::memory_order_relaxed);
+    netInfo("Connecting to " + address.as_string);
+    auto socket = std::make_unique< tristan::sockets::InetSocket >();
+    if (socket->error()) {
+        m_error = socket->error();
+        netError(m_error.message());
+        return;
+    }
+    if (address.is_ipv6) {
+        socket->setHost(address.as_ipv6, m_host);
+    } else {
+        socket->setHost(address.as_int, m_host);
+    }
+    socket->setPort(m_port);
+    socket->setNonBlocking();
+    if (m_ssl) {
+        tristan::network::private_::TlsSessionCache::instance().apply(m_host, m_port, *socket);
+    }
+    socket->connect(m_ssl);
+    if (socket->error() && not tristan::network::private_::ConnectionRace::_inProgress(socket->error())) {
+        m_error = socket->error();
+        netWarning("Connection attempt to " + address.as_string + " failed: " + m_error.message());
+        m_next_attempt_time = p_now;
+        return;
+    }
+    m_want_read.push_back(tristan::network::private_::ConnectionRace::_wantRead(socket->error()));
+    socket->resetError();
+    m_attempts.emplace_back(std::move(socket));
+}
+
+void tristan::network::private_::ConnectionRace::_clearAttempts() {
+    m_attempts.clear();
+    m_want_read.clear();
+    m_read_fds.clear();
+    m_write_fds.clear();
+}
+
+auto tristan::network::private_::ConnectionRace::_inProgress(const std::error_code& p_error) -> bool {
+    return p_error.value() == static_cast< int >(tristan::sockets::Error::CONNECT_TRY_AGAIN)
+           || p_error.value() == static_cast< int >(tristan::sockets::Error::CONNECT_IN_PROGRESS)
+           || p_error.value() == static_cast< int >(tristan::sockets::Error::CONNECT_ALREADY_IN_PROCESS)
+           || p_error.value() == static_cast< int >(tristan::sockets::Error::WRITE_TRY_AGAIN)
+           || p_error.value() == static_cast< int >(tristan::sockets::Error::READ_TRY_AGAIN);
+}
+
+auto tristan::network::private_::ConnectionRace::_wantRead(const std::error_code& p_error) -> bool {
+    return p_error.value() == static_cast< int >(tristan::sockets::Error::READ_TRY_AGAIN);
+}
@@ -0,0 +1,33 @@
+#include "event_notifier.hpp"
+#include "network_logger.hpp"
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <cstdint>
+
+tristan::network::private_::EventNotifier::EventNotifier() :
+    m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (m_fd == -1) {
+        m_error = std::error_code(errno, std::system_category());
+        netError(m_error.message());
+    }
+}
+
+tristan::network::private_::EventNotifier::~EventNotifier() {
+    if (m_fd != -1) {
+        close(m_fd);
+    }
+}
+
+void tristan::network::private_::EventNotifier::notify() {
+    if (m_fd == -1) {
+        return;
+    }
+    uint64_t value = 1;
+    [[maybe_unused]] auto result = write(m_fd, &value, sizeof(value));
+}
+
+auto tristan::network::private_::EventNotifier::fd() const noexcept -> int { return m_fd; }
+
+auto tristan::network::private_::EventNotifier::error() const noexcept -> const std::error_code& { return m_error; }
@@ -0,0 +1,94 @@
+#include "file_body_sender.hpp"
+#include "network_logger.hpp"
+
+#include <socket_error.hpp>
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+
+tristan::network::private_::FileBodySender::FileBodySender(tristan::sockets::InetSocket& p_socket, const FileBody& p_body) :
+    m_socket(p_socket),
+    m_offset(p_body.m_offset),
+    m_bytes_remain(p_body.m_length),
+    m_chunk_offset(0),
+    m_fd(::open(p_body.m_path.c_str(), O_RDONLY | O_CLOEXEC)),
+    m_would_block(false) {
+    if (m_fd == -1) {
+        m_error = std::error_code(errno, std::system_category());
+        netError("Could not open " + p_body.m_path.string() + ": " + m_error.message());
+    }
+}
+
+tristan::network::private_::FileBodySender::~FileBodySender() {
+    if (m_fd != -1) {
+        ::close(m_fd);
+    }
+}
+
+auto tristan::network::private_::FileBodySender::send(uint16_t p_frame_size) -> uint64_t {
+    m_would_block = false;
+    if (m_error || m_bytes_remain == 0) {
+        return 0;
+    }
+    //Kernel TLS is not used by the sockets, so encrypted data has to pass through user space.
+    if (m_socket.ssl() == nullptr) {
+        return tristan::network::private_::FileBodySender::_sendFile(p_frame_size);
+    }
+    return tristan::network::private_::FileBodySender::_sendChunk(p_frame_size);
+}
+
+auto tristan::network::private_::FileBodySender::done() const noexcept -> bool { return m_bytes_remain == 0; }
+
+auto tristan::network::private_::FileBodySender::wouldBlock() const noexcept -> bool { return m_would_block; }
+
+auto tristan::network::private_::FileBodySender::error() const noexcept -> const std::error_code& { return m_error; }
+
+auto tristan::network::private_::FileBodySender::_sendFile(uint16_t p_frame_size) -> uint64_t {
+    auto offset = static_cast< off_t >(m_offset);
+    auto bytes_sent = ::sendfile(m_socket.fd(), m_fd, &offset, std::min< uint64_t >(p_frame_size, m_bytes_remain));
+    if (bytes_sent < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            m_would_block = true;
+        } else {
+            m_error = std::error_code(errno, std::system_category());
+        }
+        return 0;
+    }
+    if (bytes_sent == 0) {
+        //File was truncated after Content-Length was computed.
+        m_error = std::make_error_code(std::errc::io_error);
+        return 0;
+    }
+    m_offset += static_cast< uint64_t >(bytes_sent);
+    m_bytes_remain -= static_cast< uint64_t >(bytes_sent);
+    return static_cast< uint64_t >(bytes_sent);
+}
+
+auto tristan::network::private_::FileBodySender::_sendChunk(uint16_t p_frame_size) -> uint64_t {
+    if (m_chunk_offset == m_chunk.size()) {
+        m_chunk.resize(std::min< uint64_t >(p_frame_size, m_bytes_remain));
+        auto bytes_read = ::pread(m_fd, m_chunk.data(), m_chunk.size(), static_cast< off_t >(m_offset));
+        if (bytes_read <= 0) {
+            m_error = (bytes_read < 0 ? std::error_code(errno, std::system_category()) : std::make_error_code(std::errc::io_error));
+            return 0;
+        }
+        m_chunk.resize(static_cast< size_t >(bytes_read));
+        m_chunk_offset = 0;
+    }
+    auto bytes_sent = m_socket.write(m_chunk, static_cast< uint16_t >(m_chunk.size() - m_chunk_offset), m_chunk_offset);
+    if (m_socket.error()) {
+        if (m_socket.error().value() == static_cast< int >(tristan::sockets::Error::WRITE_TRY_AGAIN)) {
+            m_would_block = true;
+            m_socket.resetError();
+        } else {
+            m_error = m_socket.error();
+        }
+    }
+    m_chunk_offset += bytes_sent;
+    m_offset += bytes_sent;
+    m_bytes_remain -= bytes_sent;
+    return bytes_sent;
+}
@@ -0,0 +1,265 @@
+#include "http_chunked_decoder.hpp"
+#include "network_error.hpp"
+#include "network_logger.hpp"
+#include "byte_scanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    [[nodiscard]] constexpr auto hexDigit(uint8_t p_character) noexcept -> int8_t {
+        if (p_character >= '0' && p_character <= '9') {
+            return static_cast< int8_t >(p_character - '0');
+        }
+        if (p_character >= 'a' && p_character <= 'f') {
+            return static_cast< int8_t >(p_character - 'a' + 10);
+        }
+        if (p_character >= 'A' && p_character <= 'F') {
+            return static_cast< int8_t >(p_character - 'A' + 10);
+        }
+        return -1;
+    }
+
+    [[nodiscard]] constexpr auto isWhiteSpace(uint8_t p_character) noexcept -> bool { return p_character == ' ' || p_character == '\t'; }
+
+    /**
+     * \brief Shortest possible remainder of the chunked body which starts with a chunk size line, that is last chunk "0\n\n".
+     */
+    constexpr uint64_t g_last_chunk_min_size = 3;
+
+}  //End of unnamed namespace
+
+tristan::network::HttpChunkedDecoder::HttpChunkedDecoder() :
+    m_chunk_size(0),
+    m_bytes_remain(0),
+    m_line_size(0),
+    m_state(State::CHUNK_SIZE) { }
+
+auto tristan::network::HttpChunkedDecoder::consume(std::span< const uint8_t > p_data) -> Result {
+    size_t position = 0;
+    //Line terminator is CRLF, though bare LF is accepted as RFC 9112 allows.
+    while (position < p_data.size() && m_state != State::DONE && m_state != State::FAILED) {
+        auto character = p_data[position];
+        switch (m_state) {
+            case State::CHUNK_SIZE:
+            case State::CHUNK_SIZE_DIGITS: {
+                auto digit = hexDigit(character);
+                if (digit >= 0) {
+                    if (m_chunk_size > (UINT64_MAX >> 8)) {
+                        netError("Chunk size is too big");
+                        tristan::network::HttpChunkedDecoder::_fail();
+                        break;
+                    }
+                    m_chunk_size = (m_chunk_size << 4) | static_cast< uint64_t >(digit);
+                    m_state = State::CHUNK_SIZE_DIGITS;
+                } else if (m_state == State::CHUNK_SIZE) {
+                    netError("Chunk size line does not start with hex digit");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                } else if (character == ';' || isWhiteSpace(character)) {
+                    m_state = State::CHUNK_EXTENSION;
+                } else if (character == '\r') {
+                    m_state = State::CHUNK_SIZE_LF;
+                } else if (character == '\n') {
+                    tristan::network::HttpChunkedDecoder::_endChunkSizeLine();
+                } else {
+                    netError("Bad character in chunk size line");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                }
+                ++position;
+                ++m_line_size;
+                break;
+            }
+            case State::CHUNK_EXTENSION: {
+                //Extensions carry nothing the handlers use, hence they are skipped up to the end of the line.
+                const auto* data_end = p_data.data() + p_data.size();
+                const auto* line_end = tristan::network::private_::findByte(p_data.data() + position, data_end, '\n');
+                auto extension_size = static_cast< size_t >(line_end - p_data.data()) - position;
+                position += extension_size;
+                m_line_size += extension_size;
+                if (line_end != data_end) {
+                    ++position;
+                    tristan::network::HttpChunkedDecoder::_endChunkSizeLine();
+                }
+                break;
+            }
+            case State::CHUNK_SIZE_LF: {
+                if (character != '\n') {
+                    netError("Chunk size line is not terminated by CRLF");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                }
+                ++position;
+                tristan::network::HttpChunkedDecoder::_endChunkSizeLine();
+                break;
+            }
+            case State::CHUNK_DATA: {
+                auto body_size = static_cast< size_t >(std::min< uint64_t >(m_bytes_remain, p_data.size() - position));
+                m_bytes_remain -= body_size;
+                if (m_bytes_remain == 0) {
+                    m_state = State::CHUNK_DATA_CR;
+                }
+                return {position + body_size, p_data.subspan(position, body_size)};
+            }
+            case State::CHUNK_DATA_CR: {
+                if (character == '\r') {
+                    m_state = State::CHUNK_DATA_LF;
+                } else if (character == '\n') {
+                    m_state = State::CHUNK_SIZE;
+                } else {
+                    netError("Chunk data is not terminated by CRLF");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                }
+                ++position;
+                break;
+            }
+            case State::CHUNK_DATA_LF: {
+                if (character != '\n') {
+                    netError("Chunk data is not terminated by CRLF");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                }
+                ++position;
+                m_state = State::CHUNK_SIZE;
+                break;
+            }
+            case State::TRAILER: {
+                if (character == '\r') {
+                    ++position;
+                    m_state = State::TRAILER_LF;
+                } else if (character == '\n') {
+                    ++position;
+                    m_state = State::DONE;
+                } else {
+                    m_state = State::TRAILER_LINE;
+                }
+                break;
+            }
+            case State::TRAILER_LINE: {
+                position = tristan::network::HttpChunkedDecoder::_consumeTrailerLine(p_data, position);
+                break;
+            }
+            case State::TRAILER_LF: {
+                if (character != '\n') {
+                    netError("Trailer section is not terminated by CRLF");
+                    tristan::network::HttpChunkedDecoder::_fail();
+                    break;
+                }
+                ++position;
+                m_state = State::DONE;
+                break;
+            }
+            case State::DONE:
+            case State::FAILED:
+                break;
+        }
+        if (m_line_size > max_chunk_line_size) {
+            netError("Chunk size line exceeds the limit");
+            tristan::network::HttpChunkedDecoder::_fail();
+        }
+    }
+    return {position, {}};
+}
+
+auto tristan::network::HttpChunkedDecoder::decode(std::span< uint8_t > p_data) -> size_t {
+    size_t body_size = 0;
+    size_t position = 0;
+    while (position < p_data.size() && m_state != State::DONE && m_state != State::FAILED) {
+        auto result = tristan::network::HttpChunkedDecoder::consume(p_data.subspan(position));
+        if (not result.m_body.empty() && result.m_body.data() != p_data.data() + body_size) {
+            std::memmove(p_data.data() + body_size, result.m_body.data(), result.m_body.size());
+        }
+        body_size += result.m_body.size();
+        position += result.m_consumed;
+    }
+    return body_size;
+}
+
+auto tristan::network::HttpChunkedDecoder::bytesExpected() const noexcept -> uint64_t {
+    switch (m_state) {
+        case State::CHUNK_SIZE:
+            return g_last_chunk_min_size;
+        case State::CHUNK_SIZE_DIGITS:
+        case State::CHUNK_EXTENSION:
+        case State::CHUNK_SIZE_LF:
+            //Parsed digits give the lower bound of the chunk size since more digits may only increase it.
+            if (m_chunk_size == 0) {
+                return 2;
+            }
+            return 1 + m_chunk_size + 1 + g_last_chunk_min_size;
+        case State::CHUNK_DATA:
+            return m_bytes_remain + 1 + g_last_chunk_min_size;
+        case State::CHUNK_DATA_CR:
+        case State::CHUNK_DATA_LF:
+            return 1 + g_last_chunk_min_size;
+        case State::TRAILER:
+        case State::TRAILER_LF:
+            return 1;
+        case State::TRAILER_LINE:
+            return 2;
+        case State::DONE:
+        case State::FAILED:
+            return 0;
+    }
+    return 0;
+}
+
+void tristan::network::HttpChunkedDecoder::reset() {
+    m_trailers.clear();
+    m_error.clear();
+    m_chunk_size = 0;
+    m_bytes_remain = 0;
+    m_line_size = 0;
+    m_state = State::CHUNK_SIZE;
+}
+
+auto tristan::network::HttpChunkedDecoder::state() const noexcept -> State { return m_state; }
+
+auto tristan::network::HttpChunkedDecoder::done() const noexcept -> bool { return m_state == State::DONE; }
+
+auto tristan::network::HttpChunkedDecoder::failed() const noexcept -> bool { return m_state == State::FAILED; }
+
+auto tristan::network::HttpChunkedDecoder::error() const noexcept -> const std::error_code& { return m_error; }
+
+auto tristan::network::HttpChunkedDecoder::trailers() const noexcept -> const std::string& { return m_trailers; }
+
+auto tristan::network::HttpChunkedDecoder::_consumeTrailerLine(std::span< const uint8_t > p_data, size_t p_position) -> size_t {
+    const auto* data_end = p_data.data() + p_data.size();
+    const auto* line_end = tristan::network::private_::findByte(p_data.data() + p_position, data_end, '\n');
+    auto fragment_size = static_cast< size_t >(line_end - p_data.data()) - p_position;
+    if (m_trailers.size() + fragment_size + 2 > max_trailers_size) {
+        netError("Trailer section exceeds the limit");
+        tristan::network::HttpChunkedDecoder::_fail();
+        return p_data.size();
+    }
+    m_trailers.append(reinterpret_cast< const char* >(p_data.data()) + p_position, fragment_size);
+    if (line_end == data_end) {
+        return p_data.size();
+    }
+    //Trailer fields are stored with CRLF regardless of the terminator which was received.
+    if (not m_trailers.empty() && m_trailers.back() == '\r') {
+        m_trailers.pop_back();
+    }
+    m_trailers += "\r\n";
+    m_state = State::TRAILER;
+    return p_position + fragment_size + 1;
+}
+
+void tristan::network::HttpChunkedDecoder::_endChunkSizeLine() {
+    m_line_size = 0;
+    if (m_chunk_size == 0) {
+        m_state = State::TRAILER;
+        return;
+    }
+    m_bytes_remain = m_chunk_size;
+    m_chunk_size = 0;
+    m_state = State::CHUNK_DATA;
+}
+
+void tristan::network::HttpChunkedDecoder::_fail() {
+    m_error = tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_BAD_CHUNKED_ENCODING);
+    m_state = State::FAILED;
+}
@@ -1,5 +1,6 @@
 #include "http_header.hpp"
 #include "network_logger.hpp"
+#include "byte_scanner.hpp"
 
 #include <algorithm>
 
@@ -12,10 +13,11 @@ tristan::network::HttpHeaders::HttpHeaders(const std::string& p_headers_data) {
         if (new_line_start >= p_headers_data.size() - 1) {
             break;
         }
-        size_t new_line_end = p_headers_data.find("\r\n", new_line_start);
-        if (new_line_end == std::string::npos){
-            new_line_end = p_headers_data.size();
-        }
+        constexpr uint8_t line_delimiter[] = {'\r', '\n'};
+        const auto* data_begin = reinterpret_cast< const uint8_t* >(p_headers_data.data());
+        const auto* data_end = data_begin + p_headers_data.size();
+        auto new_line_end = static_cast< size_t >(
+            tristan::network::private_::findSequence(data_begin + new_line_start, data_end, line_delimiter) - data_begin);
         auto line = p_headers_data.substr(new_line_start, new_line_end - new_line_start);
         if (line.find("HTTP/") != std::string::npos) {
             netDebug("Http base bar was received");
@@ -29,15 +31,12 @@ tristan::network::HttpHeaders::HttpHeaders(const std::string& p_headers_data) {
             continue;
         }
         auto header_name = line.substr(0, header_name_end);
-        for (auto& character: header_name) {
-            character = static_cast< char >(std::tolower(character));
-        }
         auto header_value_start = header_name_end + 1;
-        if (line.at(header_value_start) == ' ') {
+        if (header_value_start < line.size() && line.at(header_value_start) == ' ') {
             ++header_value_start;
         }
         auto header_value = line.substr(header_value_start, line.size() - header_value_start);
-        m_headers.emplace_back(std::move(header_name), std::move(header_value));
+        tristan::network::HttpHeaders::addHeader({std::move(header_name), std::move(header_value)});
         new_line_start = new_line_end + 2;
     }
     netTrace("End");
@@ -46,32 +45,107 @@ tristan::network::HttpHeaders::HttpHeaders(const std::string& p_headers_data) {
 tristan::network::HttpHeaders::HttpHeaders(std::vector< uint8_t >&& p_headers_data) :
     tristan::network::HttpHeaders(std::string(p_headers_data.begin(), p_headers_data.end())) { }
 
+tristan::network::HttpHeaders::HttpHeaders(const HttpResponseParser& p_parser) {
+    m_headers.reserve(p_parser.fields().size());
+    m_name_hashes.reserve(p_parser.fields().size());
+    m_ids.reserve(p_parser.fields().size());
+    for (const auto& field: p_parser.fields()) {
+        tristan::network::HttpHeaders::_addHeader(
+            {std::string(p_parser.name(field)), std::string(p_parser.value(field))}, field.m_name_hash, field.m_id);
+    }
+}
+
 auto tristan::network::HttpHeaders::headerValue(const std::string& p_header_name) const -> std::optional< std::string > {
-    auto found = std::find_if(m_headers.begin(), m_headers.end(), [p_header_name](const tristan::network::Header& header) -> bool {
-        return header.m_name == p_header_name;
-    });
-    if (found == m_headers.cend()) {
+    if (auto header_value = tristan::network::HttpHeaders::value(p_header_name)) {
+        return std::string(header_value.value());
+    }
+    return std::nullopt;
+}
+
+auto tristan::network::HttpHeaders::value(std::string_view p_header_name) const noexcept -> std::optional< std::string_view > {
+    auto index = tristan::network::HttpHeaders::_find(p_header_name, 0);
+    if (index == m_headers.size()) {
         return std::nullopt;
     }
-    return found->m_string;
+    return m_headers[index].m_string;
 }
 
-void tristan::network::HttpHeaders::addHeader(tristan::network::Header&& p_header) { m_headers.emplace_back(std::move(p_header)); }
+auto tristan::network::HttpHeaders::values(std::string_view p_header_name) const -> std::vector< std::string_view > {
+    auto header_id = tristan::network::http::headerId(p_header_name);
+    if (header_id != tristan::network::http::HeaderId::UNKNOWN) {
+        return tristan::network::HttpHeaders::values(header_id);
+    }
+    std::vector< std::string_view > header_values;
+    for (auto index = tristan::network::HttpHeaders::_find(p_header_name, 0); index != m_headers.size();
+         index = tristan::network::HttpHeaders::_find(p_header_name, index + 1)) {
+        header_values.emplace_back(m_headers[index].m_string);
+    }
+    return header_values;
+}
 
-auto tristan::network::HttpHeaders::empty() -> bool { return m_headers.empty(); }
+auto tristan::network::HttpHeaders::contains(std::string_view p_header_name) const noexcept -> bool {
+    return tristan::network::HttpHeaders::_find(p_header_name, 0) != m_headers.size();
+}
 
-auto tristan::network::HttpHeaders::begin() noexcept -> std::vector< tristan::network::Header>::iterator {
-    return m_headers.begin();
+auto tristan::network::HttpHeaders::value(tristan::network::http::HeaderId p_header_id) const noexcept -> std::optional< std::string_view > {
+    auto index = tristan::network::HttpHeaders::_find(p_header_id, 0);
+    if (index == m_headers.size()) {
+        return std::nullopt;
+    }
+    return m_headers[index].m_string;
 }
 
-auto tristan::network::HttpHeaders::cbegin() const noexcept -> std::vector< tristan::network::Header>::const_iterator {
-    return m_headers.cbegin();
+auto tristan::network::HttpHeaders::values(tristan::network::http::HeaderId p_header_id) const -> std::vector< std::string_view > {
+    std::vector< std::string_view > header_values;
+    for (auto index = tristan::network::HttpHeaders::_find(p_header_id, 0); index != m_headers.size();
+         index = tristan::network::HttpHeaders::_find(p_header_id, index + 1)) {
+        header_values.emplace_back(m_headers[index].m_string);
+    }
+    return header_values;
 }
 
-auto tristan::network::HttpHeaders::end() noexcept -> std::vector< tristan::network::Header>::iterator {
-    return m_headers.end();
+auto tristan::network::HttpHeaders::contains(tristan::network::http::HeaderId p_header_id) const noexcept -> bool {
+    return tristan::network::HttpHeaders::_find(p_header_id, 0) != m_headers.size();
+}
+
+void tristan::network::HttpHeaders::addHeader(tristan::network::Header&& p_header) {
+    auto name_hash = tristan::network::http::headerNameHash(p_header.m_name);
+    auto header_id = tristan::network::http::headerId(p_header.m_name, name_hash);
+    tristan::network::HttpHeaders::_addHeader(std::move(p_header), name_hash, header_id);
+}
+
+auto tristan::network::HttpHeaders::empty() const noexcept -> bool { return m_headers.empty(); }
+
+auto tristan::network::HttpHeaders::begin() const noexcept -> std::vector< tristan::network::Header >::const_iterator { return m_headers.cbegin(); }
+
+auto tristan::network::HttpHeaders::cbegin() const noexcept -> std::vector< tristan::network::Header >::const_iterator { return m_headers.cbegin(); }
+
+auto tristan::network::HttpHeaders::end() const noexcept -> std::vector< tristan::network::Header >::const_iterator { return m_headers.cend(); }
+
+auto tristan::network::HttpHeaders::cend() const noexcept -> std::vector< tristan::network::Header >::const_iterator { return m_headers.cend(); }
+
+void tristan::network::HttpHeaders::_addHeader(tristan::network::Header&& p_header, uint32_t p_name_hash, tristan::network::http::HeaderId p_id) {
+    m_headers.emplace_back(std::move(p_header));
+    m_name_hashes.push_back(p_name_hash);
+    m_ids.push_back(p_id);
+}
+
+auto tristan::network::HttpHeaders::_find(std::string_view p_header_name, size_t p_from) const noexcept -> size_t {
+    auto hash = tristan::network::http::headerNameHash(p_header_name);
+    auto header_id = tristan::network::http::headerId(p_header_name, hash);
+    if (header_id != tristan::network::http::HeaderId::UNKNOWN) {
+        return tristan::network::HttpHeaders::_find(header_id, p_from);
+    }
+    for (auto index = p_from; index < m_headers.size(); ++index) {
+        //Hash mismatch rejects almost every other header without touching its name.
+        if (m_name_hashes[index] == hash && tristan::network::http::headerNamesEqual(m_headers[index].m_name, p_header_name)) {
+            return index;
+        }
+    }
+    return m_headers.size();
 }
 
-auto tristan::network::HttpHeaders::cend() const noexcept -> std::vector< tristan::network::Header>::const_iterator {
-    return m_headers.cend();
+auto tristan::network::HttpHeaders::_find(tristan::network::http::HeaderId p_header_id, size_t p_from) const noexcept -> size_t {
+    auto found = std::find(m_ids.begin() + static_cast< std::ptrdiff_t >(p_from), m_ids.end(), p_header_id);
+    return static_cast< size_t >(found - m_ids.begin());
 }
@@ -0,0 +1,65 @@
+#include "http_pipeline.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+tristan::network::private_::HttpPipeline::HttpPipeline(uint8_t p_depth) :
+    m_answered(0),
+    m_depth(p_depth),
+    m_closed(false) { }
+
+auto tristan::network::private_::HttpPipeline::append(std::shared_ptr< HttpRequest > p_http_request) -> bool {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (m_closed || m_unsent_requests.size() + m_in_flight_requests.size() >= m_depth) {
+        return false;
+    }
+    m_unsent_requests.push_back(std::move(p_http_request));
+    return true;
+}
+
+void tristan::network::private_::HttpPipeline::takeUnsent(std::vector< std::shared_ptr< HttpRequest > >& p_http_requests) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    for (auto& http_request: m_unsent_requests) {
+        if (http_request->isPaused() || http_request->isCanceled()) {
+            continue;
+        }
+        m_in_flight_requests.push_back(http_request);
+        p_http_requests.push_back(std::move(http_request));
+    }
+    m_unsent_requests.clear();
+}
+
+auto tristan::network::private_::HttpPipeline::front() -> std::shared_ptr< HttpRequest > {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (m_in_flight_requests.empty()) {
+        //Requests appended after this point start a new pipeline, otherwise they could be left unwritten.
+        m_closed = true;
+        return nullptr;
+    }
+    return m_in_flight_requests.front();
+}
+
+void tristan::network::private_::HttpPipeline::pop() {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (not m_in_flight_requests.empty()) {
+        m_in_flight_requests.pop_front();
+        ++m_answered;
+    }
+}
+
+auto tristan::network::private_::HttpPipeline::close() -> std::vector< std::shared_ptr< HttpRequest > > {
+    std::vector< std::shared_ptr< HttpRequest > > unanswered_requests;
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_closed = true;
+    unanswered_requests.reserve(m_in_flight_requests.size() + m_unsent_requests.size());
+    std::move(m_in_flight_requests.begin(), m_in_flight_requests.end(), std::back_inserter(unanswered_requests));
+    std::move(m_unsent_requests.begin(), m_unsent_requests.end(), std::back_inserter(unanswered_requests));
+    m_in_flight_requests.clear();
+    m_unsent_requests.clear();
+    return unanswered_requests;
+}
+
+auto tristan::network::private_::HttpPipeline::answered() const -> size_t {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    return m_answered;
+}
@@ -24,7 +24,7 @@ tristan::network::HttpRequest::HttpRequest(Url&& url) :
         tristan::network::NetworkRequestBase::setError(tristan::network::makeError(tristan::network::ErrorCode::INVALID_URL));
         return;
     }
-    m_headers.addHeader(tristan::network::Header(tristan::network::http::header_names::host, m_url.host()));
+    m_headers.addHeader(tristan::network::Header(std::string(tristan::network::http::header_names::host), m_url.host()));
     if (m_url.portUint16_t_local_byte_order() == 443) {
         m_ssl = true;
     }
@@ -51,6 +51,17 @@ void tristan::network::HttpRequest::initResponse(std::vector< uint8_t >&& header
     m_response = tristan::network::HttpResponse::createResponse(m_uuid, std::move(headers_data));
 }
 
+void tristan::network::HttpRequest::initResponse(const HttpResponseParser& p_parser) {
+    auto response = tristan::network::HttpResponse::createResponse(m_uuid, p_parser);
+    if (response->error()) {
+        tristan::network::NetworkRequestBase::setError(response->error());
+        return;
+    }
+    m_response = std::move(response);
+}
+
+auto tristan::network::HttpRequest::bodyFile() const noexcept -> const std::optional< FileBody >& { return m_body_file; }
+
 tristan::network::GetRequest::GetRequest(Url&& url) :
     HttpRequest(std::move(url)) { }
 
@@ -111,63 +122,98 @@ tristan::network::PostRequest::PostRequest(const tristan::network::Url& url) :
 
 void tristan::network::PostRequest::setBody(std::string&& p_body) {
     m_body = std::move(p_body);
+    m_body_file.reset();
 }
 
 void tristan::network::PostRequest::setBody(const std::string& p_body) {
     m_body = p_body;
+    m_body_file.reset();
+}
+
+void tristan::network::PostRequest::setBodyFromFile(const std::filesystem::path& p_path, uint64_t p_offset, uint64_t p_length) {
+    std::error_code error;
+    auto file_size = std::filesystem::file_size(p_path, error);
+    if (error) {
+        netError("Could not get size of " + p_path.string() + ": " + error.message());
+        tristan::network::NetworkRequestBase::setError(error);
+        return;
+    }
+    if (p_offset > file_size || (p_length != 0 && p_length > file_size - p_offset)) {
+        netError("Requested part is out of the " + p_path.string() + " bounds");
+        tristan::network::NetworkRequestBase::setError(std::make_error_code(std::errc::invalid_argument));
+        return;
+    }
+    m_body.clear();
+    m_body_file = tristan::network::FileBody{p_path, p_offset, (p_length != 0 ? p_length : file_size - p_offset)};
 }
 
 auto tristan::network::PostRequest::requestData() -> const std::vector< uint8_t >& {
-    if (not m_request_composed) {
-        if (m_body.empty() and not m_params.empty()) {
-            int param_count = 0;
-            for (const auto& param: m_params) {
-                if (param_count > 0) {
-                    m_body += '&';
-                }
-                m_body += param.m_name;
-                m_body += '=';
-                auto content_type = m_headers.headerValue(tristan::network::http::header_names::content_type);
-                if (content_type && content_type.value() == "application/x-www-form-urlencoded") {
-                    m_body += tristan::network::utility::encodeUrl(param.m_string);
-                } else if (content_type && content_type.value() == "multipart/form-data") {
-                    //NOTE: To be developed in following versions
-                } else {
-                    m_body += param.m_string;
-                }
-                ++param_count;
-            }
-        }
-        m_headers.addHeader(tristan::network::Header(tristan::network::http::header_names::content_length, std::to_string(m_body.size())));
-        std::string to_insert = "POST ";
-        m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
-        if (m_url.path().empty() || m_url.path().at(0) != '/') {
-            m_request_data.push_back('/');
-        }
-        m_request_data.insert(m_request_data.end(), m_url.path().begin(), m_url.path().end());
-        to_insert = " HTTP/1.1\r\n";
-        m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
+    static_cast< void >(requestBuffers());
+    if (not m_body.empty()) {
+        m_request_data.insert(m_request_data.end(), m_body.begin(), m_body.end());
+        m_body.clear();
+        m_body.shrink_to_fit();
+    }
+    return m_request_data;
+}
 
-        if (!m_headers.empty()) {
-            for (const auto& header: m_headers) {
-                m_request_data.insert(m_request_data.end(), header.m_name.begin(), header.m_name.end());
-                m_request_data.push_back(':');
-                m_request_data.insert(m_request_data.end(), header.m_string.begin(), header.m_string.end());
-                m_request_data.push_back('\r');
-                m_request_data.push_back('\n');
+auto tristan::network::PostRequest::requestBuffers() -> std::vector< std::span< const uint8_t > > {
+    tristan::network::PostRequest::_composeRequestHead("POST");
+    std::vector< std::span< const uint8_t > > buffers{std::span< const uint8_t >(m_request_data.data(), m_request_data.size())};
+    if (not m_body.empty()) {
+        buffers.emplace_back(reinterpret_cast< const uint8_t* >(m_body.data()), m_body.size());
+    }
+    return buffers;
+}
+
+void tristan::network::PostRequest::_composeRequestHead(const std::string& p_method) {
+    if (m_request_composed) {
+        return;
+    }
+    if (m_body.empty() and not m_body_file and not m_params.empty()) {
+        int param_count = 0;
+        for (const auto& param: m_params) {
+            if (param_count > 0) {
+                m_body += '&';
             }
+            m_body += param.m_name;
+            m_body += '=';
+            auto content_type = m_headers.value(tristan::network::http::HeaderId::CONTENT_TYPE);
+            if (content_type && content_type.value() == "application/x-www-form-urlencoded") {
+                m_body += tristan::network::utility::encodeUrl(param.m_string);
+            } else if (content_type && content_type.value() == "multipart/form-data") {
+                //NOTE: To be developed in following versions
+            } else {
+                m_body += param.m_string;
+            }
+            ++param_count;
         }
-
-        m_request_data.push_back('\r');
-        m_request_data.push_back('\n');
-
-        if (not m_body.empty()) {
-            m_request_data.insert(m_request_data.end(), m_body.begin(), m_body.end());
+    }
+    auto content_length = (m_body_file ? m_body_file->m_length : m_body.size());
+    m_headers.addHeader(tristan::network::Header(std::string(tristan::network::http::header_names::content_length), std::to_string(content_length)));
+    std::string to_insert = p_method + ' ';
+    m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
+    if (m_url.path().empty() || m_url.path().at(0) != '/') {
+        m_request_data.push_back('/');
+    }
+    m_request_data.insert(m_request_data.end(), m_url.path().begin(), m_url.path().end());
+    to_insert = " HTTP/1.1\r\n";
+    m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
+
+    if (!m_headers.empty()) {
+        for (const auto& header: m_headers) {
+            m_request_data.insert(m_request_data.end(), header.m_name.begin(), header.m_name.end());
+            m_request_data.push_back(':');
+            m_request_data.insert(m_request_data.end(), header.m_string.begin(), header.m_string.end());
+            m_request_data.push_back('\r');
+            m_request_data.push_back('\n');
         }
-        m_request_data.shrink_to_fit();
-        m_request_composed = true;
     }
-    return m_request_data;
+
+    m_request_data.push_back('\r');
+    m_request_data.push_back('\n');
+    m_request_data.shrink_to_fit();
+    m_request_composed = true;
 }
 
 tristan::network::PutRequest::PutRequest(tristan::network::Url&& url) :
@@ -176,55 +222,7 @@ tristan::network::PutRequest::PutRequest(tristan::network::Url&& url) :
 tristan::network::PutRequest::PutRequest(const tristan::network::Url& url) :
     PostRequest(url) { }
 
-auto tristan::network::PutRequest::requestData() -> const std::vector< uint8_t >& {
-    if (not m_request_composed) {
-        if (m_body.empty() and not m_params.empty()) {
-            int param_count = 0;
-            for (const auto& param: m_params) {
-                if (param_count > 0) {
-                    m_body += '&';
-                }
-                m_body += param.m_name;
-                m_body += '=';
-                auto content_type = m_headers.headerValue(tristan::network::http::header_names::content_type);
-                if (content_type && content_type.value() == "application/x-www-form-urlencoded") {
-                    m_body += tristan::network::utility::encodeUrl(param.m_string);
-                } else if (content_type && content_type.value() == "multipart/form-data") {
-                    //NOTE: To be developed in following versions
-                } else {
-                    m_body += param.m_string;
-                }
-                ++param_count;
-            }
-        }
-        m_headers.addHeader(tristan::network::Header(tristan::network::http::header_names::content_length, std::to_string(m_body.size())));
-        std::string to_insert = "PUT ";
-        m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
-        if (m_url.path().empty() || m_url.path().at(0) != '/') {
-            m_request_data.push_back('/');
-        }
-        m_request_data.insert(m_request_data.end(), m_url.path().begin(), m_url.path().end());
-        to_insert = " HTTP/1.1\r\n";
-        m_request_data.insert(m_request_data.end(), to_insert.begin(), to_insert.end());
-
-        if (!m_headers.empty()) {
-            for (const auto& header: m_headers) {
-                m_request_data.insert(m_request_data.end(), header.m_name.begin(), header.m_name.end());
-                m_request_data.push_back(':');
-                m_request_data.insert(m_request_data.end(), header.m_string.begin(), header.m_string.end());
-                m_request_data.push_back('\r');
-                m_request_data.push_back('\n');
-            }
-        }
-
-        m_request_data.push_back('\r');
-        m_request_data.push_back('\n');
-
-        if (not m_body.empty()) {
-            m_request_data.insert(m_request_data.end(), m_body.begin(), m_body.end());
-        }
-        m_request_data.shrink_to_fit();
-        m_request_composed = true;
-    }
-    return m_request_data;
+auto tristan::network::PutRequest::requestBuffers() -> std::vector< std::span< const uint8_t > > {
+    tristan::network::PostRequest::_composeRequestHead("PUT");
+    return tristan::network::PostRequest::requestBuffers();
 }
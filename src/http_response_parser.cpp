@@ -0,0 +1,223 @@
+#include "http_response_parser.hpp"
+#include "network_error.hpp"
+#include "network_logger.hpp"
+#include "byte_scanner.hpp"
+
+#include <algorithm>
+
+namespace {
+
+    [[nodiscard]] constexpr auto isDigit(uint8_t p_character) noexcept -> bool { return p_character >= '0' && p_character <= '9'; }
+
+    [[nodiscard]] constexpr auto isWhiteSpace(uint8_t p_character) noexcept -> bool { return p_character == ' ' || p_character == '\t'; }
+
+    /**
+     * \brief Returns true if p_character is allowed in header name (tchar in RFC 9110).
+     */
+    [[nodiscard]] constexpr auto isTokenCharacter(uint8_t p_character) noexcept -> bool {
+        if (isDigit(p_character) || (p_character >= 'a' && p_character <= 'z') || (p_character >= 'A' && p_character <= 'Z')) {
+            return true;
+        }
+        switch (p_character) {
+            case '!':
+            case '#':
+            case '$':
+            case '%':
+            case '&':
+            case '\'':
+            case '*':
+            case '+':
+            case '-':
+            case '.':
+            case '^':
+            case '_':
+            case '`':
+            case '|':
+            case '~':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * \brief Returns true if p_character is allowed in header value or reason phrase.
+     */
+    [[nodiscard]] constexpr auto isFieldCharacter(uint8_t p_character) noexcept -> bool {
+        return p_character == '\t' || (p_character >= 0x20 && p_character != 0x7f);
+    }
+
+}  //End of unnamed namespace
+
+tristan::network::HttpResponseParser::HttpResponseParser() :
+    m_line_start(0),
+    m_reason_offset(0),
+    m_reason_length(0),
+    m_status(0),
+    m_minor_version(0),
+    m_state(State::STATUS_LINE) { }
+
+auto tristan::network::HttpResponseParser::consume(std::span< const uint8_t > p_data) -> size_t {
+    size_t consumed = 0;
+    while (consumed < p_data.size() && m_state != State::DONE && m_state != State::FAILED) {
+        const auto* data_end = p_data.data() + p_data.size();
+        const auto* line_end = tristan::network::private_::findByte(p_data.data() + consumed, data_end, '\n');
+        auto fragment_size = static_cast< size_t >(line_end - p_data.data()) - consumed + (line_end == data_end ? 0 : 1);
+        if (m_data.size() + fragment_size > max_headers_size) {
+            tristan::network::HttpResponseParser::_fail(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_HEADERS_TOO_LARGE));
+            break;
+        }
+        m_data.insert(m_data.end(), p_data.begin() + static_cast< std::ptrdiff_t >(consumed), p_data.begin() + static_cast< std::ptrdiff_t >(consumed + fragment_size));
+        consumed += fragment_size;
+        if (line_end == data_end) {
+            break;
+        }
+        //Line terminator is CRLF, though bare LF is accepted as RFC 9112 allows.
+        auto line_begin = m_line_start;
+        auto content_end = m_data.size() - 1;
+        if (content_end > line_begin && m_data.at(content_end - 1) == '\r') {
+            --content_end;
+        }
+        m_line_start = m_data.size();
+        if (m_state == State::STATUS_LINE) {
+            if (not tristan::network::HttpResponseParser::_parseStatusLine(line_begin, content_end)) {
+                tristan::network::HttpResponseParser::_fail(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_BAD_RESPONSE_FORMAT));
+                break;
+            }
+            m_state = State::HEADERS;
+        } else if (content_end == line_begin) {
+            m_state = State::DONE;
+        } else if (not tristan::network::HttpResponseParser::_parseHeaderLine(line_begin, content_end)) {
+            tristan::network::HttpResponseParser::_fail(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_BAD_RESPONSE_FORMAT));
+            break;
+        }
+    }
+    return consumed;
+}
+
+void tristan::network::HttpResponseParser::reset() {
+    m_data.clear();
+    m_fields.clear();
+    m_error.clear();
+    m_line_start = 0;
+    m_reason_offset = 0;
+    m_reason_length = 0;
+    m_status = 0;
+    m_minor_version = 0;
+    m_state = State::STATUS_LINE;
+}
+
+auto tristan::network::HttpResponseParser::state() const noexcept -> State { return m_state; }
+
+auto tristan::network::HttpResponseParser::done() const noexcept -> bool { return m_state == State::DONE; }
+
+auto tristan::network::HttpResponseParser::failed() const noexcept -> bool { return m_state == State::FAILED; }
+
+auto tristan::network::HttpResponseParser::error() const noexcept -> const std::error_code& { return m_error; }
+
+auto tristan::network::HttpResponseParser::status() const noexcept -> uint16_t { return m_status; }
+
+auto tristan::network::HttpResponseParser::minorVersion() const noexcept -> uint8_t { return m_minor_version; }
+
+auto tristan::network::HttpResponseParser::reason() const noexcept -> std::string_view {
+    return {reinterpret_cast< const char* >(m_data.data()) + m_reason_offset, m_reason_length};
+}
+
+auto tristan::network::HttpResponseParser::fields() const noexcept -> const std::vector< Field >& { return m_fields; }
+
+auto tristan::network::HttpResponseParser::name(const Field& p_field) const noexcept -> std::string_view {
+    return {reinterpret_cast< const char* >(m_data.data()) + p_field.m_name_offset, p_field.m_name_length};
+}
+
+auto tristan::network::HttpResponseParser::value(const Field& p_field) const noexcept -> std::string_view {
+    return {reinterpret_cast< const char* >(m_data.data()) + p_field.m_value_offset, p_field.m_value_length};
+}
+
+auto tristan::network::HttpResponseParser::data() const noexcept -> const std::vector< uint8_t >& { return m_data; }
+
+auto tristan::network::HttpResponseParser::_parseStatusLine(size_t p_begin, size_t p_end) -> bool {
+    //HTTP/1.x SP 3DIGIT [SP reason-phrase]
+    constexpr std::string_view version_prefix = "HTTP/1.";
+    if (p_end - p_begin < version_prefix.size() + 5) {
+        return false;
+    }
+    if (not std::equal(version_prefix.begin(), version_prefix.end(), m_data.begin() + static_cast< std::ptrdiff_t >(p_begin))) {
+        return false;
+    }
+    auto position = p_begin + version_prefix.size();
+    auto minor_version = m_data.at(position);
+    if (minor_version != '0' && minor_version != '1') {
+        return false;
+    }
+    m_minor_version = static_cast< uint8_t >(minor_version - '0');
+    ++position;
+    if (m_data.at(position) != ' ') {
+        return false;
+    }
+    ++position;
+    uint16_t status = 0;
+    for (auto status_end = position + 3; position < status_end; ++position) {
+        if (not isDigit(m_data.at(position))) {
+            return false;
+        }
+        status = static_cast< uint16_t >(status * 10 + (m_data.at(position) - '0'));
+    }
+    if (status < 100) {
+        return false;
+    }
+    m_status = status;
+    if (position == p_end) {
+        m_reason_offset = static_cast< uint32_t >(position);
+        m_reason_length = 0;
+        return true;
+    }
+    if (m_data.at(position) != ' ') {
+        return false;
+    }
+    ++position;
+    if (not std::all_of(m_data.begin() + static_cast< std::ptrdiff_t >(position), m_data.begin() + static_cast< std::ptrdiff_t >(p_end), isFieldCharacter)) {
+        return false;
+    }
+    m_reason_offset = static_cast< uint32_t >(position);
+    m_reason_length = static_cast< uint32_t >(p_end - position);
+    return true;
+}
+
+auto tristan::network::HttpResponseParser::_parseHeaderLine(size_t p_begin, size_t p_end) -> bool {
+    //field-name ":" OWS field-value OWS. Obsolete line folding is rejected since it starts with whitespace.
+    auto position = p_begin;
+    while (position < p_end && isTokenCharacter(m_data.at(position))) {
+        ++position;
+    }
+    if (position == p_begin || position == p_end || m_data.at(position) != ':') {
+        netError("HTTP header format not conform");
+        return false;
+    }
+    auto name_end = position;
+    ++position;
+    while (position < p_end && isWhiteSpace(m_data.at(position))) {
+        ++position;
+    }
+    auto value_end = p_end;
+    while (value_end > position && isWhiteSpace(m_data.at(value_end - 1))) {
+        --value_end;
+    }
+    if (not std::all_of(m_data.begin() + static_cast< std::ptrdiff_t >(position), m_data.begin() + static_cast< std::ptrdiff_t >(value_end), isFieldCharacter)) {
+        netError("HTTP header value contains forbidden characters");
+        return false;
+    }
+    std::string_view name(reinterpret_cast< const char* >(m_data.data()) + p_begin, name_end - p_begin);
+    auto name_hash = tristan::network::http::headerNameHash(name);
+    m_fields.push_back({static_cast< uint32_t >(p_begin),
+                        static_cast< uint32_t >(name_end - p_begin),
+                        static_cast< uint32_t >(position),
+                        static_cast< uint32_t >(value_end - position),
+                        name_hash,
+                        tristan::network::http::headerId(name, name_hash)});
+    return true;
+}
+
+void tristan::network::HttpResponseParser::_fail(std::error_code p_error) {
+    m_error = p_error;
+    m_state = State::FAILED;
+}
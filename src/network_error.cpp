@@ -29,6 +29,7 @@ namespace /*anonymous*/
         {tristan::network::ErrorCode::ASYNC_NETWORK_REQUEST_HANDLER_WAS_NOT_LUNCHED, "AsyncRequestHandler run() function was not invoked"   },
         {tristan::network::ErrorCode::REQUEST_SIZE_IS_NOT_APPROPRIATE,               "Request has not either bytes to read either delimiter"},
         {tristan::network::ErrorCode::REQUEST_NOT_SUPPORTED,                         "Request type is not supported"                        },
+        {tristan::network::ErrorCode::REQUEST_HANDLER_STOPPED,                       "Request handler was stopped"                          },
     };
 
     /**
@@ -66,9 +67,11 @@ namespace /*anonymous*/
     inline const NetworkResponseCategory g_network_response_error_category;
 
     inline const std::map< tristan::network::NetworkResponseError, const char* > g_network_response_code_descriptions{
-        {tristan::network::NetworkResponseError::SUCCESS,                  "Success"                                                                         },
-        {tristan::network::NetworkResponseError::HTTP_BAD_RESPONSE_FORMAT, "Bad format of the received http response"                                        },
-        {tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR, "Content-length and transfer-encoding chunked are not present in response headers"},
+        {tristan::network::NetworkResponseError::SUCCESS,                   "Success"                                                                         },
+        {tristan::network::NetworkResponseError::HTTP_BAD_RESPONSE_FORMAT,  "Bad format of the received http response"                                        },
+        {tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR,  "Content-length and transfer-encoding chunked are not present in response headers"},
+        {tristan::network::NetworkResponseError::HTTP_HEADERS_TOO_LARGE,    "Size of the received http response headers exceeds the limit"                    },
+        {tristan::network::NetworkResponseError::HTTP_BAD_CHUNKED_ENCODING, "Chunked http response body is malformed"                                         },
     };
 
 }  // namespace
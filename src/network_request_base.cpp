@@ -3,18 +3,33 @@
 
 #include <socket_error.hpp>
 
+namespace {
+
+    /**
+     * \brief Upper bound of the space reserved from Content-Length, larger responses grow as data arrives.
+     */
+    constexpr uint64_t g_max_reserved_response_size = 16 * 1024 * 1024;
+
+}  //End of unnamed namespace
+
 tristan::network::NetworkRequestBase::NetworkRequestBase(tristan::network::Url&& p_url) :
     request_handlers_api(*this),
     m_url(std::move(p_url)),
     m_uuid(utility::getUuid()),
-    m_timeout(std::chrono::seconds(5)),
+    m_connect_timeout(std::chrono::seconds(5)),
+    m_first_byte_timeout(std::chrono::seconds(5)),
+    m_idle_timeout(std::chrono::seconds(5)),
+    m_total_timeout(0),
     m_bytes_to_read(0),
     m_bytes_read(0),
+    m_read_buffer_size(0),
+    m_write_buffer_size(0),
     m_status(Status::WAITING),
     m_priority(Priority::NORMAL),
     m_paused(false),
     m_canceled(false),
     m_output_to_file(false),
+    m_segmented_response_storage(false),
     m_ssl(false) { }
 
 void tristan::network::NetworkRequestBase::notifyWhenBytesReadChanged() {
@@ -140,7 +155,15 @@ void tristan::network::NetworkRequestBase::notifyWhenFailed() {
 
 void tristan::network::NetworkRequestBase::addResponseData(std::vector< uint8_t >&& p_data) {
     auto data_size = p_data.size();
-    if (not m_output_to_file) {
+    if (not m_output_to_file && m_segmented_response_storage) {
+        if (not m_response) {
+            m_response = tristan::network::NetworkResponse::createResponse(m_uuid);
+        }
+        if (not m_response->m_segmented_response_data) {
+            m_response->m_segmented_response_data = std::make_shared< tristan::network::SegmentedBuffer >();
+        }
+        m_response->m_segmented_response_data->append(p_data);
+    } else if (not m_output_to_file) {
         if (not m_response) {
             m_response = tristan::network::NetworkResponse::createResponse(m_uuid);
             m_response->m_response_data = std::make_shared< std::vector< uint8_t > >(std::move(p_data));
@@ -173,6 +196,73 @@ void tristan::network::NetworkRequestBase::addResponseData(std::vector< uint8_t
     tristan::network::NetworkRequestBase::notifyWhenBytesReadChanged();
 }
 
+void tristan::network::NetworkRequestBase::reserveResponseData(uint64_t p_size) {
+    if (m_output_to_file || m_segmented_response_storage) {
+        return;
+    }
+    if (not m_response) {
+        m_response = tristan::network::NetworkResponse::createResponse(m_uuid);
+    }
+    if (not m_response->m_response_data) {
+        m_response->m_response_data = std::make_shared< std::vector< uint8_t > >();
+    }
+    //Content-Length comes from the server, hence it is not trusted with an allocation of arbitrary size.
+    m_response->m_response_data->reserve(m_response->m_response_data->size() + std::min(p_size, g_max_reserved_response_size));
+}
+
+auto tristan::network::NetworkRequestBase::responseBuffer(uint64_t p_size) -> std::span< uint8_t > {
+    if (not m_output_to_file && m_segmented_response_storage) {
+        if (not m_response) {
+            m_response = tristan::network::NetworkResponse::createResponse(m_uuid);
+        }
+        if (not m_response->m_segmented_response_data) {
+            m_response->m_segmented_response_data = std::make_shared< tristan::network::SegmentedBuffer >();
+        }
+        return m_response->m_segmented_response_data->writableTail(p_size);
+    }
+    //Response data never holds bytes which were not read, since callbacks may access it while the request is processed.
+    //Read buffer only grows, hence it is zero-initialised once per request rather than on every read.
+    if (m_read_buffer.size() < p_size) {
+        m_read_buffer.resize(p_size);
+    }
+    return {m_read_buffer.data(), p_size};
+}
+
+void tristan::network::NetworkRequestBase::commitResponseData(uint64_t p_size) {
+    if (not m_output_to_file && m_segmented_response_storage) {
+        m_response->m_segmented_response_data->commit(p_size);
+    } else if (not m_output_to_file) {
+        if (not m_response) {
+            m_response = tristan::network::NetworkResponse::createResponse(m_uuid);
+        }
+        if (not m_response->m_response_data) {
+            m_response->m_response_data = std::make_shared< std::vector< uint8_t > >();
+        }
+        m_response->m_response_data->insert(m_response->m_response_data->end(), m_read_buffer.begin(), m_read_buffer.begin() + static_cast< std::ptrdiff_t >(p_size));
+    } else if (p_size != 0) {
+        if (m_output_path.empty()) {
+            tristan::network::NetworkRequestBase::setError(tristan::network::makeError(tristan::network::ErrorCode::FILE_PATH_EMPTY));
+            return;
+        }
+        if (not m_output_file) {
+            m_output_file = std::make_unique< std::ofstream >(m_output_path, std::ios::binary);
+        }
+        if (not m_output_file->is_open()) {
+            m_output_file->open(m_output_path, std::ios::ate | std::ios::binary | std::ios::app);
+            if (not m_output_file->is_open()) {
+                tristan::network::NetworkRequestBase::setError(std::error_code(errno, std::system_category()));
+                return;
+            }
+        }
+        m_output_file->write(reinterpret_cast< const char* >(m_read_buffer.data()), static_cast< std::streamsize >(p_size));
+    }
+    if (p_size == 0) {
+        return;
+    }
+    m_bytes_read += p_size;
+    tristan::network::NetworkRequestBase::notifyWhenBytesReadChanged();
+}
+
 void tristan::network::NetworkRequestBase::setStatus(tristan::network::Status p_status) {
     tristan::network::NetworkRequestBase::notifyWhenStatusChanged();
 
@@ -272,6 +362,8 @@ void tristan::network::NetworkRequestBase::outputToFile(const std::filesystem::p
     m_output_to_file = true;
 }
 
+void tristan::network::NetworkRequestBase::setSegmentedResponseStorage(bool p_value) { m_segmented_response_storage = p_value; }
+
 void tristan::network::NetworkRequestBase::cancel() { tristan::network::NetworkRequestBase::setStatus(tristan::network::Status::CANCELED); }
 
 void tristan::network::NetworkRequestBase::pauseProcessing() { tristan::network::NetworkRequestBase::setStatus(tristan::network::Status::PAUSED); }
@@ -282,7 +374,23 @@ void tristan::network::NetworkRequestBase::setRequest(std::vector< uint8_t >&& p
 
 void tristan::network::NetworkRequestBase::setRequest(const std::vector< uint8_t >& p_request_data) { m_request_data = p_request_data; }
 
-void tristan::network::NetworkRequestBase::setTimeOut(std::chrono::seconds p_timeout) { m_timeout = p_timeout; }
+void tristan::network::NetworkRequestBase::setTimeOut(std::chrono::milliseconds p_timeout) {
+    m_connect_timeout = p_timeout;
+    m_first_byte_timeout = p_timeout;
+    m_idle_timeout = p_timeout;
+}
+
+void tristan::network::NetworkRequestBase::setConnectTimeOut(std::chrono::milliseconds p_timeout) { m_connect_timeout = p_timeout; }
+
+void tristan::network::NetworkRequestBase::setFirstByteTimeOut(std::chrono::milliseconds p_timeout) { m_first_byte_timeout = p_timeout; }
+
+void tristan::network::NetworkRequestBase::setIdleTimeOut(std::chrono::milliseconds p_timeout) { m_idle_timeout = p_timeout; }
+
+void tristan::network::NetworkRequestBase::setTotalTimeOut(std::chrono::milliseconds p_timeout) { m_total_timeout = p_timeout; }
+
+void tristan::network::NetworkRequestBase::setReadBufferSize(uint16_t p_size) { m_read_buffer_size = p_size; }
+
+void tristan::network::NetworkRequestBase::setWriteBufferSize(uint16_t p_size) { m_write_buffer_size = p_size; }
 
 auto tristan::network::NetworkRequestBase::uuid() const noexcept -> const std::string& { return m_uuid; }
 
@@ -306,9 +414,26 @@ auto tristan::network::NetworkRequestBase::responseDelimiter() const noexcept ->
 
 //auto tristan::network::NetworkRequestBase::requestData() -> const std::vector< uint8_t >& { return m_request_data; }
 
+auto tristan::network::NetworkRequestBase::requestBuffers() -> std::vector< std::span< const uint8_t > > {
+    const auto& request_data = requestData();
+    return {std::span< const uint8_t >(request_data.data(), request_data.size())};
+}
+
 auto tristan::network::NetworkRequestBase::response() -> std::shared_ptr< NetworkResponse > { return m_response; }
 
-auto tristan::network::NetworkRequestBase::timeout() const -> std::chrono::seconds { return m_timeout; }
+auto tristan::network::NetworkRequestBase::timeout() const -> std::chrono::milliseconds { return m_idle_timeout; }
+
+auto tristan::network::NetworkRequestBase::connectTimeOut() const -> std::chrono::milliseconds { return m_connect_timeout; }
+
+auto tristan::network::NetworkRequestBase::firstByteTimeOut() const -> std::chrono::milliseconds { return m_first_byte_timeout; }
+
+auto tristan::network::NetworkRequestBase::idleTimeOut() const -> std::chrono::milliseconds { return m_idle_timeout; }
+
+auto tristan::network::NetworkRequestBase::totalTimeOut() const -> std::chrono::milliseconds { return m_total_timeout; }
+
+auto tristan::network::NetworkRequestBase::readBufferSize() const noexcept -> uint16_t { return m_read_buffer_size; }
+
+auto tristan::network::NetworkRequestBase::writeBufferSize() const noexcept -> uint16_t { return m_write_buffer_size; }
 
 void tristan::network::NetworkRequestBase::addReadBytesValueChangedCallback(std::function< void(uint64_t) >&& p_function) {
     m_read_bytes_changed_callback_functors.emplace_back(std::move(p_function));
@@ -389,3 +514,13 @@ void tristan::network::NetworkRequestBase::FriendClassesAPI::addResponseData(std
 void tristan::network::NetworkRequestBase::FriendClassesAPI::setStatus(tristan::network::Status p_status) { m_base.setStatus(p_status); }
 
 void tristan::network::NetworkRequestBase::FriendClassesAPI::setError(std::error_code p_error_code) { m_base.setError(p_error_code); }
+
+void tristan::network::NetworkRequestBase::FriendClassesAPI::reserveResponseData(uint64_t p_size) { m_base.reserveResponseData(p_size); }
+
+auto tristan::network::NetworkRequestBase::FriendClassesAPI::responseBuffer(uint64_t p_size) -> std::span< uint8_t > { return m_base.responseBuffer(p_size); }
+
+void tristan::network::NetworkRequestBase::FriendClassesAPI::commitResponseData(uint64_t p_size) { m_base.commitResponseData(p_size); }
+
+auto tristan::network::NetworkRequestBase::FriendClassesAPI::nextInQueue() -> std::shared_ptr< NetworkRequestBase >& { return m_base.m_next_in_queue; }
+
+auto tristan::network::NetworkRequestBase::FriendClassesAPI::enqueuedAt() -> std::chrono::steady_clock::time_point& { return m_base.m_enqueued_at; }
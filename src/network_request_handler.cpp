@@ -1,9 +1,31 @@
 #include "network_request_handler.hpp"
 #include "sync_network_request_handler_impl.hpp"
 #include "async_request_handler.hpp"
+#include "mpsc_queue.hpp"
+#include "request_scheduler.hpp"
+#include "admission_controller.hpp"
+#include "connection_pool.hpp"
+#include "tls_session_cache.hpp"
+#include "connection_race.hpp"
 #include "network_logger.hpp"
 #include "http_response.hpp"
 
+#include <algorithm>
+
+tristan::network::NetworkRequestsHandler::NetworkRequestsHandler() :
+    m_requests(std::make_unique< tristan::network::private_::RequestScheduler >()),
+    m_admission_controller(std::make_unique< tristan::network::private_::AdmissionController >()),
+    m_submitted_requests(std::make_unique< tristan::network::private_::MpscQueue< std::shared_ptr< NetworkRequestBase > > >()),
+    m_working(false),
+    m_paused(false),
+    m_dispatcher_waiting(false),
+    m_async_requests_distribution(AsyncRequestsDistribution::HOST_HASH),
+    m_out_of_queue_requests_limit(64),
+    m_out_of_queue_workers_count(8),
+    m_async_handlers_count(0),
+    m_http_pipelining_depth(0),
+    m_work_stealing(false) { }
+
 tristan::network::NetworkRequestsHandler::~NetworkRequestsHandler() {
     if (m_working.load(std::memory_order_relaxed)) {
         netWarning("Loop was not stopped before destructor and all requests being processed will be discarded.");
@@ -30,7 +52,81 @@ void tristan::network::NetworkRequestsHandler::pause() { tristan::network::Netwo
 void tristan::network::NetworkRequestsHandler::resume() { tristan::network::NetworkRequestsHandler::instance()._resume(); }
 
 void tristan::network::NetworkRequestsHandler::setActiveDownloadsLimit(uint8_t p_limit) {
-    NetworkRequestsHandler::instance().m_async_tcp_requests_handler->setMaxDownloadsCount(p_limit);
+    auto& network_requests_handler = NetworkRequestsHandler::instance();
+    network_requests_handler.m_admission_controller->setGlobalLimit(p_limit);
+    {
+        std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    }
+    network_requests_handler.m_requests_cv.notify_one();
+}
+
+void tristan::network::NetworkRequestsHandler::setActiveDownloadsPerHostLimit(uint8_t p_limit) {
+    auto& network_requests_handler = NetworkRequestsHandler::instance();
+    network_requests_handler.m_admission_controller->setHostLimit(p_limit);
+    {
+        std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    }
+    network_requests_handler.m_requests_cv.notify_one();
+}
+
+void tristan::network::NetworkRequestsHandler::setMaxIdleConnectionsPerHost(uint8_t p_count) {
+    tristan::network::private_::ConnectionPool::instance().setMaxIdleConnectionsPerHost(p_count);
+}
+
+void tristan::network::NetworkRequestsHandler::setIdleConnectionTimeOut(std::chrono::milliseconds p_time_out) {
+    tristan::network::private_::ConnectionPool::instance().setIdleTimeOut(p_time_out);
+}
+
+void tristan::network::NetworkRequestsHandler::setTlsSessionCacheSize(uint16_t p_capacity) {
+    tristan::network::private_::TlsSessionCache::instance().setCapacity(p_capacity);
+}
+
+void tristan::network::NetworkRequestsHandler::setConnectionAttemptDelay(std::chrono::milliseconds p_delay) {
+    tristan::network::private_::ConnectionRace::setAttemptDelay(p_delay);
+}
+
+void tristan::network::NetworkRequestsHandler::setReadBufferSize(uint16_t p_size) {
+    tristan::network::private_::NetworkRequestHandlerImpl::setDefaultReadFrameSize(p_size);
+}
+
+void tristan::network::NetworkRequestsHandler::setWriteBufferSize(uint16_t p_size) {
+    tristan::network::private_::NetworkRequestHandlerImpl::setDefaultWriteFrameSize(p_size);
+}
+
+void tristan::network::NetworkRequestsHandler::setAsyncHandlersCount(uint8_t p_count) { NetworkRequestsHandler::instance().m_async_handlers_count = p_count; }
+
+void tristan::network::NetworkRequestsHandler::setAsyncRequestsDistribution(AsyncRequestsDistribution p_distribution) {
+    NetworkRequestsHandler::instance().m_async_requests_distribution.store(p_distribution, std::memory_order_relaxed);
+}
+
+void tristan::network::NetworkRequestsHandler::setWorkStealing(bool p_enabled) { NetworkRequestsHandler::instance().m_work_stealing = p_enabled; }
+
+void tristan::network::NetworkRequestsHandler::setHttpPipeliningDepth(uint8_t p_depth) { NetworkRequestsHandler::instance().m_http_pipelining_depth = p_depth; }
+
+void tristan::network::NetworkRequestsHandler::setSchedulingPolicy(SchedulingPolicy p_policy) {
+    auto& network_requests_handler = NetworkRequestsHandler::instance();
+    std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    network_requests_handler.m_requests->setPolicy(p_policy);
+}
+
+void tristan::network::NetworkRequestsHandler::setPriorityWeights(uint8_t p_high, uint8_t p_normal, uint8_t p_low) {
+    auto& network_requests_handler = NetworkRequestsHandler::instance();
+    std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    network_requests_handler.m_requests->setWeights(p_high, p_normal, p_low);
+}
+
+void tristan::network::NetworkRequestsHandler::setLowPriorityAgingThreshold(std::chrono::milliseconds p_threshold) {
+    auto& network_requests_handler = NetworkRequestsHandler::instance();
+    std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    network_requests_handler.m_requests->setAgingThreshold(p_threshold);
+}
+
+void tristan::network::NetworkRequestsHandler::setOutOfQueueWorkersCount(uint8_t p_count) {
+    NetworkRequestsHandler::instance().m_out_of_queue_workers_count = p_count;
+}
+
+void tristan::network::NetworkRequestsHandler::setOutOfQueueRequestsLimit(uint16_t p_limit) {
+    NetworkRequestsHandler::instance().m_out_of_queue_requests_limit = p_limit;
 }
 
 void tristan::network::NetworkRequestsHandler::notifyWhenExit(std::function< void() >&& p_function) {
@@ -41,8 +137,13 @@ void tristan::network::NetworkRequestsHandler::addRequest(std::shared_ptr< Netwo
     NetworkRequestsHandler::instance()._addRequest(std::move(p_request));
 }
 
-auto tristan::network::NetworkRequestsHandler::pendingRequests() -> std::ranges::ref_view< std::multiset< std::shared_ptr< NetworkRequestBase > > > {
-    return {tristan::network::NetworkRequestsHandler::instance().m_requests};
+auto tristan::network::NetworkRequestsHandler::pendingRequests() -> std::vector< std::shared_ptr< NetworkRequestBase > > {
+    auto& network_requests_handler = tristan::network::NetworkRequestsHandler::instance();
+    std::scoped_lock< std::mutex > lock(network_requests_handler.m_nr_queue_lock);
+    auto requests = network_requests_handler.m_requests->snapshot();
+    auto parked_requests = network_requests_handler.m_admission_controller->parkedRequests();
+    requests.insert(requests.end(), parked_requests.begin(), parked_requests.end());
+    return requests;
 }
 
 auto tristan::network::NetworkRequestsHandler::activeRequests() -> std::list< std::shared_ptr< NetworkRequestBase > >& {
@@ -55,52 +156,106 @@ auto tristan::network::NetworkRequestsHandler::errorRequests() -> const std::lis
 
 void tristan::network::NetworkRequestsHandler::_run() {
 
-    m_async_tcp_requests_handler = tristan::network::private_::AsyncRequestHandler::create();
-    m_request_handler = std::make_unique< tristan::network::private_::SyncNetworkRequestHandlerImpl >();
-    netInfo("Launching Async request handler");
-    m_async_request_handler_thread = std::thread(&tristan::network::private_::AsyncRequestHandler::run, std::ref(*m_async_tcp_requests_handler));
+    auto async_handlers_count = static_cast< uint32_t >(m_async_handlers_count);
+    if (async_handlers_count == 0) {
+        async_handlers_count = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    m_request_handler = std::make_unique< tristan::network::private_::SyncNetworkRequestHandlerImpl >(m_out_of_queue_workers_count, m_out_of_queue_requests_limit);
+    netInfo("Launching " + std::to_string(async_handlers_count) + " Async request handlers");
+    m_async_requests_handlers.clear();
+    for (uint32_t index = 0; index < async_handlers_count; ++index) {
+        m_async_requests_handlers.emplace_back(tristan::network::private_::AsyncRequestHandler::create());
+        m_async_requests_handlers.back()->setHttpPipeliningDepth(m_http_pipelining_depth);
+    }
+    if (m_work_stealing) {
+        for (auto& async_requests_handler: m_async_requests_handlers) {
+            std::vector< tristan::network::private_::AsyncRequestHandler* > siblings;
+            for (auto& sibling: m_async_requests_handlers) {
+                if (sibling != async_requests_handler) {
+                    siblings.push_back(sibling.get());
+                }
+            }
+            async_requests_handler->setSiblings(std::move(siblings));
+        }
+    }
+    for (auto& async_requests_handler: m_async_requests_handlers) {
+        m_async_request_handler_threads.emplace_back(&tristan::network::private_::AsyncRequestHandler::run, std::ref(*async_requests_handler));
+    }
     if (not m_working.load(std::memory_order_relaxed)) {
         m_working.store(true, std::memory_order_relaxed);
     } else {
         netWarning("Function run() was invoked twice");
     }
     while (m_working.load(std::memory_order_relaxed)) {
-        if (m_requests.empty() || m_paused.load(std::memory_order_relaxed)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        } else {
-            std::unique_lock< std::mutex > lock(m_nr_multiset_lock);
-            auto network_request = *m_requests.begin();
-            m_requests.erase(m_requests.begin());
-            lock.unlock();
-            auto network_request_uuid = network_request->uuid();
-            network_request->addFinishedCallback([this, network_request_uuid]() -> void {
-                std::scoped_lock< std::mutex > lock(m_active_nr_lock);
-                m_active_requests.remove_if([network_request_uuid](const std::shared_ptr< NetworkRequestBase >& stored_request) {
-                    auto stored_request_uuid = stored_request->uuid();
-                    netDebug("Removing network request from active requests uuid = " + network_request_uuid);
-                    return stored_request_uuid == network_request_uuid;
-                });
-            });
-            network_request->addFailedCallback([this, network_request_uuid]() -> void {
-                for (auto iter = m_active_requests.begin(); iter != m_active_requests.end(); ++iter) {
-                    if ((*iter)->uuid() == network_request_uuid) {
-                        std::scoped_lock< std::mutex > error_lock(m_error_nr_lock);
-                        netDebug("Storing network request to failed requests uuid = " + network_request_uuid);
-                        m_error_requests.emplace_back(*iter);
-                        std::scoped_lock< std::mutex > active_lock(m_active_nr_lock);
-                        netDebug("Removing network request from active requests uuid = " + network_request_uuid);
-                        m_active_requests.erase(iter);
-                        break;
-                    }
+        std::unique_lock< std::mutex > lock(m_nr_queue_lock);
+        m_requests_cv.wait(lock, [this]() -> bool {
+            //Flag is raised before the ring is drained, hence a producer either sees it or its request is drained here.
+            m_dispatcher_waiting.store(true);
+            //Pairs with the fence in _addRequest so the flag store is not reordered after the ring reads.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            tristan::network::NetworkRequestsHandler::_drainSubmittedRequests();
+            auto ready = not m_working.load(std::memory_order_relaxed)
+                      || (not m_paused.load(std::memory_order_relaxed)
+                          && (m_admission_controller->hasAdmissible() || m_requests->hasOutOfQueue()
+                              || (not m_requests->empty() && m_admission_controller->hasFreeSlot())));
+            if (ready) {
+                m_dispatcher_waiting.store(false, std::memory_order_relaxed);
+            }
+            return ready;
+        });
+        if (not m_working.load(std::memory_order_relaxed)) {
+            break;
+        }
+        bool admitted = false;
+        auto network_request = tristan::network::NetworkRequestsHandler::_nextRequest(admitted);
+        lock.unlock();
+        if (not network_request) {
+            continue;
+        }
+        if (admitted) {
+            //Slot is released by whichever of the callbacks comes first.
+            auto released = std::make_shared< std::atomic< bool > >(false);
+            auto release = [this, released, host = tristan::network::private_::AdmissionController::hostKey(*network_request)]() -> void {
+                if (not released->exchange(true)) {
+                    tristan::network::NetworkRequestsHandler::_releaseAdmission(host);
                 }
+            };
+            network_request->addFinishedCallback(release);
+            network_request->addFailedCallback(release);
+            network_request->addCanceledCallback(release);
+            network_request->addPausedCallback(release);
+        }
+        auto network_request_uuid = network_request->uuid();
+        network_request->addFinishedCallback([this, network_request_uuid]() -> void {
+            std::scoped_lock< std::mutex > lock(m_active_nr_lock);
+            m_active_requests.remove_if([network_request_uuid](const std::shared_ptr< NetworkRequestBase >& stored_request) {
+                auto stored_request_uuid = stored_request->uuid();
+                netDebug("Removing network request from active requests uuid = " + network_request_uuid);
+                return stored_request_uuid == network_request_uuid;
             });
+        });
+        network_request->addFailedCallback([this, network_request_uuid]() -> void {
+            for (auto iter = m_active_requests.begin(); iter != m_active_requests.end(); ++iter) {
+                if ((*iter)->uuid() == network_request_uuid) {
+                    std::scoped_lock< std::mutex > error_lock(m_error_nr_lock);
+                    netDebug("Storing network request to failed requests uuid = " + network_request_uuid);
+                    m_error_requests.emplace_back(*iter);
+                    std::scoped_lock< std::mutex > active_lock(m_active_nr_lock);
+                    netDebug("Removing network request from active requests uuid = " + network_request_uuid);
+                    m_active_requests.erase(iter);
+                    break;
+                }
+            }
+        });
+        {
             std::scoped_lock< std::mutex > active_lock(m_active_nr_lock);
             m_active_requests.emplace_back(network_request);
-            if (network_request->priority() == tristan::network::Priority::OUT_OF_QUEUE) {
-                m_request_handler->handleRequest(std::move(network_request));
-            } else {
-                m_async_tcp_requests_handler->addRequest(std::move(network_request));
-            }
+        }
+        //Submitting to the full worker queue blocks until workers drain it, and workers invoke callbacks which take m_active_nr_lock.
+        if (network_request->priority() == tristan::network::Priority::OUT_OF_QUEUE) {
+            m_request_handler->handleRequest(std::move(network_request));
+        } else {
+            tristan::network::NetworkRequestsHandler::_selectAsyncRequestHandler(network_request).addRequest(std::move(network_request));
         }
     }
     if (not m_working.load(std::memory_order_relaxed)) {
@@ -112,27 +267,121 @@ void tristan::network::NetworkRequestsHandler::_run() {
     }
 }
 
-void tristan::network::NetworkRequestsHandler::_pause() { m_paused.store(true, std::memory_order_relaxed); }
+void tristan::network::NetworkRequestsHandler::_pause() {
+    {
+        std::scoped_lock< std::mutex > lock(m_nr_queue_lock);
+        m_paused.store(true, std::memory_order_relaxed);
+    }
+    m_requests_cv.notify_all();
+}
 
-void tristan::network::NetworkRequestsHandler::_resume() { m_paused.store(false, std::memory_order_relaxed); }
+void tristan::network::NetworkRequestsHandler::_resume() {
+    {
+        std::scoped_lock< std::mutex > lock(m_nr_queue_lock);
+        m_paused.store(false, std::memory_order_relaxed);
+    }
+    m_requests_cv.notify_all();
+}
 
 void tristan::network::NetworkRequestsHandler::_stop() {
-    m_async_tcp_requests_handler->stop();
-    m_async_request_handler_thread.join();
-    std::scoped_lock< std::mutex > active_lock(m_active_nr_lock);
-    std::scoped_lock< std::mutex > nr_lock(m_nr_multiset_lock);
+    for (auto& async_requests_handler: m_async_requests_handlers) {
+        async_requests_handler->stop();
+    }
+    for (auto& async_request_handler_thread: m_async_request_handler_threads) {
+        async_request_handler_thread.join();
+    }
+    m_async_request_handler_threads.clear();
+    std::list< std::shared_ptr< NetworkRequestBase > > active_requests;
+    {
+        std::scoped_lock< std::mutex > active_lock(m_active_nr_lock);
+        active_requests.swap(m_active_requests);
+    }
+    //Canceled callbacks release admission slots which takes m_nr_queue_lock, hence requests are canceled without holding it.
     netInfo("Cancelling active requests");
-    for (auto request_iter = m_active_requests.begin(); request_iter != m_active_requests.end();) {
-        request_iter->get()->cancel();
-        m_requests.insert(*request_iter);
-        request_iter = m_active_requests.erase(request_iter);
+    for (auto& active_request: active_requests) {
+        active_request->cancel();
+    }
+    {
+        std::scoped_lock< std::mutex > nr_lock(m_nr_queue_lock);
+        for (auto& active_request: active_requests) {
+            m_requests->push(std::move(active_request));
+        }
+    }
+    //Workers may invoke finished and failed callbacks which take m_active_nr_lock, hence they are joined without holding it.
+    netInfo("Stopping out of queue workers");
+    m_request_handler->stop();
+    {
+        std::scoped_lock< std::mutex > nr_lock(m_nr_queue_lock);
+        m_working.store(false, std::memory_order_relaxed);
     }
-    m_working.store(false, std::memory_order_relaxed);
+    m_requests_cv.notify_all();
 }
 
 void tristan::network::NetworkRequestsHandler::_addRequest(std::shared_ptr< NetworkRequestBase >&& request) {
-    std::scoped_lock< std::mutex > lock(m_nr_multiset_lock);
-    m_requests.emplace(std::move(request));
+    if (not m_submitted_requests->push(std::move(request))) {
+        {
+            std::scoped_lock< std::mutex > lock(m_nr_queue_lock);
+            m_requests->push(std::move(request));
+        }
+        m_requests_cv.notify_one();
+        return;
+    }
+    //Push ends in the release store which may otherwise be reordered after the flag load, then both sides miss each other.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_dispatcher_waiting.load()) {
+        //Taking the lock guarantees that the dispatcher is either before the drain or already waiting.
+        {
+            std::scoped_lock< std::mutex > lock(m_nr_queue_lock);
+        }
+        m_requests_cv.notify_one();
+    }
+}
+
+void tristan::network::NetworkRequestsHandler::_drainSubmittedRequests() {
+    std::shared_ptr< NetworkRequestBase > request;
+    while (m_submitted_requests->pop(request)) {
+        m_requests->push(std::move(request));
+    }
+}
+
+auto tristan::network::NetworkRequestsHandler::_nextRequest(bool& p_admitted) -> std::shared_ptr< NetworkRequestBase > {
+    if (auto network_request = m_admission_controller->popAdmissible()) {
+        p_admitted = true;
+        return network_request;
+    }
+    auto network_request = m_requests->pop();
+    if (not network_request) {
+        return nullptr;
+    }
+    //Out of queue requests have their own workers limit, while paused or canceled requests return without notifying, hence they never release a slot.
+    if (network_request->priority() == tristan::network::Priority::OUT_OF_QUEUE || network_request->isPaused() || network_request->isCanceled()) {
+        return network_request;
+    }
+    //Request which was not admitted is parked by the controller and the pointer is left empty.
+    p_admitted = m_admission_controller->tryAdmit(network_request);
+    return network_request;
+}
+
+void tristan::network::NetworkRequestsHandler::_releaseAdmission(const std::string& p_host) {
+    m_admission_controller->release(p_host);
+    {
+        std::scoped_lock< std::mutex > lock(m_nr_queue_lock);
+    }
+    m_requests_cv.notify_one();
+}
+
+auto tristan::network::NetworkRequestsHandler::_selectAsyncRequestHandler(const std::shared_ptr< NetworkRequestBase >& p_request) const
+    -> private_::AsyncRequestHandler& {
+    if (m_async_requests_distribution.load(std::memory_order_relaxed) == AsyncRequestsDistribution::LEAST_LOAD) {
+        auto least_loaded = std::min_element(m_async_requests_handlers.begin(),
+                                             m_async_requests_handlers.end(),
+                                             [](const auto& p_left, const auto& p_right) -> bool {
+                                                 return p_left->load() < p_right->load();
+                                             });
+        return **least_loaded;
+    }
+    const auto& host = p_request->url().host().empty() ? p_request->url().hostIP().as_string : p_request->url().host();
+    return *m_async_requests_handlers.at(std::hash< std::string >{}(host) % m_async_requests_handlers.size());
 }
 
 void tristan::network::NetworkRequestsHandler::_notifyWhenExit(std::function< void() >&& p_function) { m_notify_when_exit_functions.emplace_back(p_function); }
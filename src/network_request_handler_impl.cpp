@@ -3,24 +3,158 @@
 
 #include <socket_error.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <string_view>
+
+namespace {
+
+    //Frame size is limited by the Sockets API which takes uint16_t.
+    std::atomic< uint16_t > g_default_read_frame_size(std::numeric_limits< uint16_t >::max());
+    std::atomic< uint16_t > g_default_write_frame_size(std::numeric_limits< uint16_t >::max());
+
+}  //End of unnamed namespace
+
 tristan::network::private_::NetworkRequestHandlerImpl::NetworkRequestHandlerImpl() = default;
 
 tristan::network::private_::NetworkRequestHandlerImpl::~NetworkRequestHandlerImpl() = default;
 
+void tristan::network::private_::NetworkRequestHandlerImpl::setDefaultReadFrameSize(uint16_t p_size) {
+    g_default_read_frame_size.store(std::max< uint16_t >(p_size, 1), std::memory_order_relaxed);
+}
+
+void tristan::network::private_::NetworkRequestHandlerImpl::setDefaultWriteFrameSize(uint16_t p_size) {
+    g_default_write_frame_size.store(std::max< uint16_t >(p_size, 1), std::memory_order_relaxed);
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> uint16_t {
+    if (p_network_request->readBufferSize() != 0) {
+        return p_network_request->readBufferSize();
+    }
+    return g_default_read_frame_size.load(std::memory_order_relaxed);
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> uint16_t {
+    if (p_network_request->writeBufferSize() != 0) {
+        return p_network_request->writeBufferSize();
+    }
+    return g_default_write_frame_size.load(std::memory_order_relaxed);
+}
+
 void tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(const std::shared_ptr< NetworkRequestBase >& p_network_request) {
     netDebug("network_request->uuid() = " + p_network_request->uuid());
     netDebug("network_request->url().hostIP().as_string = " + p_network_request->url().hostIP().as_string);
     netDebug("network_request->url().port() = " + p_network_request->url().port());
     netDebug("network_request->url() = " + p_network_request->url().composeUrl());
-    netDebug("network_request->requestData() = " + std::string(p_network_request->requestData().begin(), p_network_request->requestData().end()));
-    netDebug("network_request->requestData().size() = " + std::to_string(p_network_request->requestData().size()));
+    //Only the first buffer is logged since the rest may hold large request body.
+    auto request_buffers = p_network_request->requestBuffers();
+    netDebug("network_request->requestBuffers().front() = " + std::string(request_buffers.front().begin(), request_buffers.front().end()));
+    netDebug("network_request->requestBuffers() size = " + std::to_string(tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(request_buffers)));
     netDebug("network_request->bytesToRead() = " + std::to_string(p_network_request->bytesToRead()));
     netDebug("network_request->responseDelimiter() = " + std::string(p_network_request->responseDelimiter().begin(), p_network_request->responseDelimiter().end()));
 }
 
+auto tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(const std::shared_ptr< NetworkRequestBase >& p_network_request)
+    -> std::chrono::steady_clock::time_point {
+    if (p_network_request->totalTimeOut().count() == 0) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return std::chrono::steady_clock::now() + p_network_request->totalTimeOut();
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::deadline(std::chrono::milliseconds p_timeout, std::chrono::steady_clock::time_point p_total_deadline)
+    -> std::chrono::steady_clock::time_point {
+    return std::min(std::chrono::steady_clock::now() + p_timeout, p_total_deadline);
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::checkHostResolved(const std::shared_ptr< NetworkRequestBase >& p_network_request) -> bool {
+    auto error = p_network_request->url().error();
+    if (not error && p_network_request->url().hostIPList().empty()) {
+        error = tristan::network::makeError(tristan::network::UrlErrors::NO_DATA_ERROR);
+    }
+    if (error) {
+        netError("Failed to resolve " + p_network_request->url().host() + ": " + error.message());
+        p_network_request->request_handlers_api.setError(error);
+        return false;
+    }
+    return true;
+}
+
+void tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(const std::shared_ptr< NetworkRequestBase >& p_network_request) {
+    netError("Network request timed out uuid = " + p_network_request->uuid());
+    p_network_request->request_handlers_api.setError(tristan::sockets::makeError(tristan::sockets::Error::SOCKET_TIMED_OUT));
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::connectionLost(const tristan::sockets::InetSocket& p_socket) -> bool {
+    return p_socket.error() && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::CONNECT_TRY_AGAIN)
+           && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::CONNECT_IN_PROGRESS)
+           && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::CONNECT_ALREADY_IN_PROCESS)
+           && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::WRITE_TRY_AGAIN)
+           && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::READ_TRY_AGAIN);
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(const std::vector< std::span< const uint8_t > >& p_buffers) -> uint64_t {
+    uint64_t size = 0;
+    for (const auto& buffer: p_buffers) {
+        size += buffer.size();
+    }
+    return size;
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::readResponseData(tristan::sockets::InetSocket& p_socket,
+                                                                             const std::shared_ptr< NetworkRequestBase >& p_network_request,
+                                                                             uint16_t p_size) -> uint64_t {
+    auto buffer = p_network_request->request_handlers_api.responseBuffer(p_size);
+    auto bytes_read = p_socket.read(buffer.data(), static_cast< uint16_t >(buffer.size()));
+    p_network_request->request_handlers_api.commitResponseData(bytes_read);
+    return bytes_read;
+}
+
+auto tristan::network::private_::NetworkRequestHandlerImpl::readChunkedResponseData(tristan::sockets::InetSocket& p_socket,
+                                                                                    const std::shared_ptr< NetworkRequestBase >& p_network_request,
+                                                                                    tristan::network::HttpChunkedDecoder& p_decoder,
+                                                                                    uint16_t p_size) -> uint64_t {
+    auto buffer = p_network_request->request_handlers_api.responseBuffer(std::min< uint64_t >(p_size, p_decoder.bytesExpected()));
+    auto bytes_read = p_socket.read(buffer.data(), static_cast< uint16_t >(buffer.size()));
+    auto body_size = p_decoder.decode(buffer.first(bytes_read));
+    p_network_request->request_handlers_api.commitResponseData(body_size);
+    if (p_decoder.failed()) {
+        p_network_request->request_handlers_api.setError(p_decoder.error());
+    }
+    return bytes_read;
+}
+
+void tristan::network::private_::NetworkRequestHandlerImpl::addTrailers(tristan::network::HttpResponse& p_response,
+                                                                        const tristan::network::HttpChunkedDecoder& p_decoder) {
+    if (p_decoder.trailers().empty() || not p_response.headers()) {
+        return;
+    }
+    //Decoder stores each trailer field terminated by CRLF. Fields are split here, since legacy HttpHeaders parser throws on empty values.
+    std::string_view trailers(p_decoder.trailers());
+    while (not trailers.empty()) {
+        auto line_end = trailers.find("\r\n");
+        auto line = trailers.substr(0, line_end);
+        trailers.remove_prefix(line_end == std::string_view::npos ? trailers.size() : line_end + 2);
+        auto name_end = line.find(':');
+        if (name_end == std::string_view::npos || name_end == 0) {
+            netWarning("Trailer field format not conform: " + std::string(line));
+            continue;
+        }
+        auto value = line.substr(name_end + 1);
+        auto value_start = value.find_first_not_of(" \t");
+        if (value_start == std::string_view::npos) {
+            value = {};
+        } else {
+            value = value.substr(value_start, value.find_last_not_of(" \t") - value_start + 1);
+        }
+        p_response.headers()->addHeader(tristan::network::Header(std::string(line.substr(0, name_end)), std::string(value)));
+    }
+}
+
 bool tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(
     const tristan::sockets::InetSocket& p_socket,
-    std::chrono::time_point< std::chrono::system_clock, std::chrono::microseconds > p_time_point,
+    std::chrono::steady_clock::time_point p_deadline,
     const std::shared_ptr<NetworkRequestBase>& p_network_request) {
     if (p_socket.error() && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::CONNECT_TRY_AGAIN)
         && p_socket.error().value() != static_cast< int >(tristan::sockets::Error::CONNECT_IN_PROGRESS)
@@ -33,10 +167,8 @@ bool tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperation
         p_network_request->request_handlers_api.setError(p_socket.error());
         return false;
     }
-    auto end = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    if (std::chrono::duration_cast< std::chrono::seconds >(end - p_time_point) >= p_network_request->timeout()) {
-        netError(p_socket.error().message());
-        p_network_request->request_handlers_api.setError(tristan::sockets::makeError(tristan::sockets::Error::SOCKET_TIMED_OUT));
+    if (std::chrono::steady_clock::now() >= p_deadline) {
+        tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_network_request);
         return false;
     }
     return true;
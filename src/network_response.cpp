@@ -9,4 +9,11 @@ auto tristan::network::NetworkResponse::createResponse(std::string p_uuid) -> st
 
 auto tristan::network::NetworkResponse::uuid() const noexcept -> const std::string& { return m_uuid; }
 
-auto tristan::network::NetworkResponse::data() const -> std::shared_ptr< std::vector< uint8_t > > { return m_response_data; }
+auto tristan::network::NetworkResponse::data() const -> std::shared_ptr< std::vector< uint8_t > > {
+    if (m_segmented_response_data) {
+        return std::make_shared< std::vector< uint8_t > >(m_segmented_response_data->contiguous());
+    }
+    return m_response_data;
+}
+
+auto tristan::network::NetworkResponse::segmentedData() const -> std::shared_ptr< SegmentedBuffer > { return m_segmented_response_data; }
@@ -0,0 +1,180 @@
+#include "reactor.hpp"
+#include "network_logger.hpp"
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <algorithm>
+
+namespace {
+
+    thread_local tristan::network::private_::Reactor* g_current_reactor = nullptr;
+
+}  //End of unnamed namespace
+
+tristan::network::private_::Reactor::Reactor() :
+    m_events(),
+    m_check_interval(std::chrono::milliseconds(250)),
+    m_current_task(nullptr),
+    m_epoll_fd(epoll_create1(EPOLL_CLOEXEC)),
+    m_wake_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (m_epoll_fd == -1 || m_wake_fd == -1) {
+        m_error = std::error_code(errno, std::system_category());
+        netError(m_error.message());
+        return;
+    }
+    //Wake descriptor is the only one registered with empty data pointer.
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &event) == -1) {
+        m_error = std::error_code(errno, std::system_category());
+        netError(m_error.message());
+    }
+}
+
+tristan::network::private_::Reactor::~Reactor() {
+    if (m_wake_fd != -1) {
+        close(m_wake_fd);
+    }
+    if (m_epoll_fd != -1) {
+        close(m_epoll_fd);
+    }
+}
+
+auto tristan::network::private_::Reactor::error() const noexcept -> const std::error_code& { return m_error; }
+
+auto tristan::network::private_::Reactor::waitFor(int p_fd, Event p_event, std::chrono::steady_clock::time_point p_deadline) -> Awaiter {
+    return {p_fd, p_event, p_deadline};
+}
+
+auto tristan::network::private_::Reactor::waitForAny(std::span< const int > p_fds, Event p_event, std::chrono::steady_clock::time_point p_deadline)
+    -> Awaiter {
+    return {p_fds, p_event, p_deadline};
+}
+
+auto tristan::network::private_::Reactor::waitForAny(std::span< const int > p_read_fds,
+                                                    std::span< const int > p_write_fds,
+                                                    std::chrono::steady_clock::time_point p_deadline) -> Awaiter {
+    return {p_read_fds, p_write_fds, p_deadline};
+}
+
+auto tristan::network::private_::Reactor::sleepUntil(std::chrono::steady_clock::time_point p_time_point) -> Awaiter {
+    return {-1, Event::READ, p_time_point};
+}
+
+auto tristan::network::private_::Reactor::current() noexcept -> Reactor* { return g_current_reactor; }
+
+void tristan::network::private_::Reactor::setCurrent(Reactor* p_reactor) noexcept { g_current_reactor = p_reactor; }
+
+void tristan::network::private_::Reactor::setCurrentTask(AsyncTask* p_task) noexcept { m_current_task = p_task; }
+
+void tristan::network::private_::Reactor::setCheckInterval(std::chrono::milliseconds p_interval) { m_check_interval = p_interval; }
+
+void tristan::network::private_::Reactor::wake() {
+    uint64_t value = 1;
+    [[maybe_unused]] auto result = write(m_wake_fd, &value, sizeof(value));
+}
+
+void tristan::network::private_::Reactor::poll(bool p_block, std::vector< AsyncTask* >& p_ready_tasks) {
+    auto timeout = p_block ? m_timers.nextTimeout() : std::chrono::milliseconds(0);
+    auto events_count = epoll_wait(m_epoll_fd, m_events.data(), static_cast< int >(m_events.size()), static_cast< int >(timeout.count()));
+    if (events_count == -1) {
+        if (errno != EINTR) {
+            netError(std::error_code(errno, std::system_category()).message());
+        }
+        events_count = 0;
+    }
+    for (int index = 0; index < events_count; ++index) {
+        auto* task = static_cast< AsyncTask* >(m_events.at(static_cast< size_t >(index)).data.ptr);
+        if (task == nullptr) {
+            uint64_t value;
+            [[maybe_unused]] auto result = read(m_wake_fd, &value, sizeof(value));
+            continue;
+        }
+        if (not task->m_waiting) {
+            continue;
+        }
+        m_timers.cancel(*task);
+        //Descriptors which did not fire are still armed and would resume the task during its next wait.
+        if (task->m_fds.size() > 1) {
+            tristan::network::private_::Reactor::_unwatch(task);
+        }
+        task->m_waiting = false;
+        task->m_timed_out = false;
+        p_ready_tasks.push_back(task);
+    }
+    auto now = std::chrono::steady_clock::now();
+    m_timers.advance(now, m_expired_timers);
+    for (auto* timer: m_expired_timers) {
+        auto* task = static_cast< AsyncTask* >(timer);
+        tristan::network::private_::Reactor::_cancelWait(task);
+        //Timer may fire on check interval, in which case the coroutine only rechecks pause and cancel and waits again.
+        task->m_timed_out = now >= task->m_deadline;
+        p_ready_tasks.push_back(task);
+    }
+    m_expired_timers.clear();
+}
+
+void tristan::network::private_::Reactor::_watch(std::span< const int > p_fds,
+                                                Event p_event,
+                                                std::span< const int > p_read_fds,
+                                                std::chrono::steady_clock::time_point p_deadline) {
+    if (m_current_task == nullptr) {
+        return;
+    }
+    m_current_task->m_fds.clear();
+    for (auto fd: p_fds) {
+        if (not tristan::network::private_::Reactor::_arm(fd, p_event)) {
+            return;
+        }
+    }
+    for (auto fd: p_read_fds) {
+        if (not tristan::network::private_::Reactor::_arm(fd, Event::READ)) {
+            return;
+        }
+    }
+    m_current_task->m_waiting = true;
+    m_current_task->m_timed_out = false;
+    m_current_task->m_deadline = p_deadline;
+    m_timers.schedule(*m_current_task, std::min(p_deadline, std::chrono::steady_clock::now() + m_check_interval));
+}
+
+auto tristan::network::private_::Reactor::_arm(int p_fd, Event p_event) -> bool {
+    if (p_fd == -1) {
+        return true;
+    }
+    epoll_event event{};
+    event.events = static_cast< uint32_t >(p_event) | EPOLLONESHOT;
+    event.data.ptr = m_current_task;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, p_fd, &event) == -1) {
+        if (errno != ENOENT || epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, p_fd, &event) == -1) {
+            //Task is not marked as waiting, hence it will be resumed on the next pass of the loop.
+            netError(std::error_code(errno, std::system_category()).message());
+            tristan::network::private_::Reactor::_unwatch(m_current_task);
+            return false;
+        }
+    }
+    m_current_task->m_fds.push_back(p_fd);
+    return true;
+}
+
+void tristan::network::private_::Reactor::_cancelWait(AsyncTask* p_task) {
+    tristan::network::private_::Reactor::_unwatch(p_task);
+    m_timers.cancel(*p_task);
+    p_task->m_waiting = false;
+}
+
+void tristan::network::private_::Reactor::_unwatch(AsyncTask* p_task) {
+    for (auto fd: p_task->m_fds) {
+        epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+    p_task->m_fds.clear();
+}
+
+void tristan::network::private_::Reactor::Awaiter::await_suspend([[maybe_unused]] std::coroutine_handle<> p_handle) {
+    if (auto* reactor = Reactor::current()) {
+        m_task = reactor->m_current_task;
+        reactor->_watch(m_fds.empty() && m_read_fds.empty() ? std::span< const int >(&m_fd, 1) : m_fds, m_event, m_read_fds, m_deadline);
+    }
+}
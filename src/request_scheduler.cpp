@@ -0,0 +1,133 @@
+#include "request_scheduler.hpp"
+#include "network_request_handler.hpp"
+
+#include <algorithm>
+
+namespace {
+
+    [[nodiscard]] auto lowerPriority(tristan::network::Priority p_priority) -> tristan::network::Priority {
+        switch (p_priority) {
+            case tristan::network::Priority::HIGH: return tristan::network::Priority::NORMAL;
+            case tristan::network::Priority::NORMAL: return tristan::network::Priority::LOW;
+            default: return tristan::network::Priority::HIGH;
+        }
+    }
+
+}  //End of unnamed namespace
+
+tristan::network::private_::RequestScheduler::RequestScheduler() :
+    m_weights{1, 2, 4, 1},
+    m_credits{1, 2, 4, 1},
+    m_aging_threshold(std::chrono::seconds(10)),
+    m_size(0),
+    m_policy(SchedulingPolicy::STRICT),
+    m_current_priority(Priority::HIGH) { }
+
+tristan::network::private_::RequestScheduler::~RequestScheduler() {
+    //Intrusive links are released iteratively to avoid deep recursion of shared_ptr destructors.
+    for (auto& queue: m_queues) {
+        while (queue.m_head) {
+            queue.m_head = std::move(queue.m_head->request_handlers_api.nextInQueue());
+        }
+    }
+}
+
+void tristan::network::private_::RequestScheduler::setPolicy(SchedulingPolicy p_policy) { m_policy = p_policy; }
+
+void tristan::network::private_::RequestScheduler::setWeights(uint8_t p_high, uint8_t p_normal, uint8_t p_low) {
+    m_weights.at(static_cast< size_t >(Priority::HIGH)) = std::max< uint8_t >(p_high, 1);
+    m_weights.at(static_cast< size_t >(Priority::NORMAL)) = std::max< uint8_t >(p_normal, 1);
+    m_weights.at(static_cast< size_t >(Priority::LOW)) = std::max< uint8_t >(p_low, 1);
+    m_credits = m_weights;
+}
+
+void tristan::network::private_::RequestScheduler::setAgingThreshold(std::chrono::milliseconds p_threshold) { m_aging_threshold = p_threshold; }
+
+void tristan::network::private_::RequestScheduler::push(std::shared_ptr< NetworkRequestBase >&& p_request) {
+    auto& queue = tristan::network::private_::RequestScheduler::_queue(p_request->priority());
+    p_request->request_handlers_api.enqueuedAt() = std::chrono::steady_clock::now();
+    p_request->request_handlers_api.nextInQueue().reset();
+    auto* request = p_request.get();
+    if (queue.m_tail == nullptr) {
+        queue.m_head = std::move(p_request);
+    } else {
+        queue.m_tail->request_handlers_api.nextInQueue() = std::move(p_request);
+    }
+    queue.m_tail = request;
+    ++queue.m_size;
+    ++m_size;
+}
+
+auto tristan::network::private_::RequestScheduler::pop() -> std::shared_ptr< NetworkRequestBase > {
+    if (m_size == 0) {
+        return nullptr;
+    }
+    if (tristan::network::private_::RequestScheduler::_queue(Priority::OUT_OF_QUEUE).m_size > 0) {
+        return tristan::network::private_::RequestScheduler::_popFrom(Priority::OUT_OF_QUEUE);
+    }
+    const auto& low_queue = tristan::network::private_::RequestScheduler::_queue(Priority::LOW);
+    if (m_aging_threshold.count() > 0 && low_queue.m_head
+        && std::chrono::steady_clock::now() - low_queue.m_head->request_handlers_api.enqueuedAt() >= m_aging_threshold) {
+        return tristan::network::private_::RequestScheduler::_popFrom(Priority::LOW);
+    }
+    if (m_policy == SchedulingPolicy::WEIGHTED_FAIR) {
+        return tristan::network::private_::RequestScheduler::_popWeighted();
+    }
+    for (auto priority: {Priority::HIGH, Priority::NORMAL, Priority::LOW}) {
+        if (tristan::network::private_::RequestScheduler::_queue(priority).m_size > 0) {
+            return tristan::network::private_::RequestScheduler::_popFrom(priority);
+        }
+    }
+    return nullptr;
+}
+
+auto tristan::network::private_::RequestScheduler::empty() const noexcept -> bool { return m_size == 0; }
+
+auto tristan::network::private_::RequestScheduler::hasOutOfQueue() const noexcept -> bool {
+    return m_queues.at(static_cast< size_t >(Priority::OUT_OF_QUEUE)).m_size > 0;
+}
+
+auto tristan::network::private_::RequestScheduler::size() const noexcept -> size_t { return m_size; }
+
+auto tristan::network::private_::RequestScheduler::snapshot() const -> std::vector< std::shared_ptr< NetworkRequestBase > > {
+    std::vector< std::shared_ptr< NetworkRequestBase > > requests;
+    requests.reserve(m_size);
+    for (auto priority: {Priority::OUT_OF_QUEUE, Priority::HIGH, Priority::NORMAL, Priority::LOW}) {
+        auto request = m_queues.at(static_cast< size_t >(priority)).m_head;
+        while (request) {
+            auto next = request->request_handlers_api.nextInQueue();
+            requests.emplace_back(std::move(request));
+            request = std::move(next);
+        }
+    }
+    return requests;
+}
+
+auto tristan::network::private_::RequestScheduler::_popFrom(Priority p_priority) -> std::shared_ptr< NetworkRequestBase > {
+    auto& queue = tristan::network::private_::RequestScheduler::_queue(p_priority);
+    auto request = std::move(queue.m_head);
+    queue.m_head = std::move(request->request_handlers_api.nextInQueue());
+    if (not queue.m_head) {
+        queue.m_tail = nullptr;
+    }
+    --queue.m_size;
+    --m_size;
+    return request;
+}
+
+auto tristan::network::private_::RequestScheduler::_popWeighted() -> std::shared_ptr< NetworkRequestBase > {
+    //Each queue is served up to its weight in a row, then the turn passes to the next lower priority.
+    //Two rounds are enough since the first one refills credits of every queue which was passed.
+    for (uint8_t step = 0; step < 7; ++step) {
+        auto index = static_cast< size_t >(m_current_priority);
+        if (m_queues.at(index).m_size > 0 && m_credits.at(index) > 0) {
+            --m_credits.at(index);
+            return tristan::network::private_::RequestScheduler::_popFrom(m_current_priority);
+        }
+        m_credits.at(index) = m_weights.at(index);
+        m_current_priority = lowerPriority(m_current_priority);
+    }
+    return nullptr;
+}
+
+auto tristan::network::private_::RequestScheduler::_queue(Priority p_priority) -> Queue& { return m_queues.at(static_cast< size_t >(p_priority)); }
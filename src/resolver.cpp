@@ -0,0 +1,319 @@
+#include "resolver.hpp"
+#include "thread_pool.hpp"
+#include "network_error.hpp"
+#include "network_utility.hpp"
+#include "network_logger.hpp"
+
+#include <netdb.h>
+#include <arpa/nameser.h>
+#include <resolv.h>
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <iterator>
+
+namespace {
+
+    constexpr uint8_t g_resolver_workers_count = 4;
+    constexpr uint16_t g_resolver_queue_limit = 1024;
+
+    [[nodiscard]] auto addressInfoError(int p_error) -> std::error_code {
+        switch (p_error) {
+            case EAI_NONAME: {
+                return tristan::network::makeError(tristan::network::UrlErrors::NOT_FOUND_ERROR);
+            }
+            case EAI_AGAIN: {
+                return tristan::network::makeError(tristan::network::UrlErrors::TRY_AGAIN_ERROR);
+            }
+#ifdef EAI_NODATA
+            case EAI_NODATA: {
+                return tristan::network::makeError(tristan::network::UrlErrors::NO_DATA_ERROR);
+            }
+#endif
+            default: {
+                return tristan::network::makeError(tristan::network::UrlErrors::NO_RECOVERY_ERROR);
+            }
+        }
+    }
+
+    [[nodiscard]] auto ipv6ToString(const std::array< uint8_t, 16 >& p_ip) -> std::string {
+        std::array< char, INET6_ADDRSTRLEN > ip{};
+        if (inet_ntop(AF_INET6, p_ip.data(), ip.data(), ip.size()) == nullptr) {
+            return {};
+        }
+        return ip.data();
+    }
+
+}  //End of unnamed namespace
+
+tristan::network::Resolver::Resolver() :
+    m_workers(std::make_unique< tristan::network::private_::ThreadPool >(g_resolver_workers_count, g_resolver_queue_limit)),
+    m_default_ttl(std::chrono::seconds(60)),
+    m_negative_ttl(std::chrono::seconds(5)) { }
+
+tristan::network::Resolver::~Resolver() = default;
+
+auto tristan::network::Resolver::instance() -> Resolver& {
+    static Resolver resolver;
+
+    return resolver;
+}
+
+auto tristan::network::Resolver::resolveAsync(const std::string& p_host) -> std::shared_future< ResolvedHost > {
+    return Resolver::instance()._resolveAsync(p_host);
+}
+
+auto tristan::network::Resolver::resolve(const std::string& p_host) -> ResolvedHost { return Resolver::instance()._resolveAsync(p_host).get(); }
+
+auto tristan::network::Resolver::notifyWhenResolved(const std::string& p_host,
+                                                     const std::shared_future< ResolvedHost >& p_result,
+                                                     std::function< void() > p_callback) -> bool {
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    //Result is set before waiters are taken under the lock, hence the callback is either invoked or the result is ready here.
+    if (not p_result.valid() || p_result.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        return false;
+    }
+    resolver.m_waiters[p_host].emplace_back(std::move(p_callback));
+    return true;
+}
+
+void tristan::network::Resolver::addHostEntry(const std::string& p_host, const std::string& p_ip) {
+    IP ip;
+    if (p_ip.find(':') != std::string::npos) {
+        if (inet_pton(AF_INET6, p_ip.c_str(), ip.as_ipv6.data()) != 1) {
+            netError(tristan::network::makeError(tristan::network::UrlErrors::IP_CONVERTER_ERROR).message());
+            return;
+        }
+        ip.is_ipv6 = true;
+    } else {
+        ip.as_int = tristan::network::utility::stringIpToUint32_tIp(p_ip);
+        if (ip.as_int == 0) {
+            netError(tristan::network::makeError(tristan::network::UrlErrors::IP_CONVERTER_ERROR).message());
+            return;
+        }
+    }
+    ip.as_string = p_ip;
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    resolver.m_hosts_table[p_host].emplace_back(std::move(ip));
+    resolver.m_cache.erase(p_host);
+}
+
+void tristan::network::Resolver::removeHostEntry(const std::string& p_host) {
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    resolver.m_hosts_table.erase(p_host);
+    resolver.m_cache.erase(p_host);
+}
+
+void tristan::network::Resolver::setDefaultTimeToLive(std::chrono::seconds p_ttl) {
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    resolver.m_default_ttl = p_ttl;
+}
+
+void tristan::network::Resolver::setNegativeTimeToLive(std::chrono::seconds p_ttl) {
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    resolver.m_negative_ttl = p_ttl;
+}
+
+void tristan::network::Resolver::clearCache() {
+    auto& resolver = Resolver::instance();
+    std::scoped_lock< std::mutex > lock(resolver.m_lock);
+    for (auto host_iterator = resolver.m_cache.begin(); host_iterator != resolver.m_cache.end();) {
+        if (host_iterator->second.expiry == std::chrono::steady_clock::time_point::max()) {
+            ++host_iterator;
+        } else {
+            host_iterator = resolver.m_cache.erase(host_iterator);
+        }
+    }
+}
+
+auto tristan::network::Resolver::_resolveAsync(const std::string& p_host) -> std::shared_future< ResolvedHost > {
+    auto promise = std::make_shared< std::promise< ResolvedHost > >();
+    std::shared_future< ResolvedHost > result;
+    {
+        std::scoped_lock< std::mutex > lock(m_lock);
+        if (auto host_entry = m_hosts_table.find(p_host); host_entry != m_hosts_table.end()) {
+            promise->set_value(ResolvedHost{host_entry->second, {}});
+            return promise->get_future().share();
+        }
+        auto cached_host = m_cache.find(p_host);
+        if (cached_host != m_cache.end() && cached_host->second.expiry > std::chrono::steady_clock::now()) {
+            return cached_host->second.result;
+        }
+        result = promise->get_future().share();
+        m_cache.insert_or_assign(p_host, CachedHost{result, std::chrono::steady_clock::time_point::max()});
+    }
+    netInfo("Resolving host " + p_host);
+    auto submitted = m_workers->submit([this, p_host, promise]() -> void {
+        tristan::network::Resolver::_resolve(p_host, promise);
+    });
+    if (not submitted) {
+        {
+            std::scoped_lock< std::mutex > lock(m_lock);
+            m_cache.erase(p_host);
+        }
+        tristan::network::Resolver::_complete(p_host, promise, ResolvedHost{{}, tristan::network::makeError(tristan::network::UrlErrors::TRY_AGAIN_ERROR)});
+    }
+    return result;
+}
+
+void tristan::network::Resolver::_resolve(const std::string& p_host, const std::shared_ptr< std::promise< ResolvedHost > >& p_result) {
+    std::chrono::seconds ttl(0);
+    ResolvedHost resolved_host;
+    //Promise is never left unset, otherwise every Url waiting for it would get broken promise.
+    try {
+        //System resolver goes first so that /etc/hosts and nsswitch.conf order are honoured.
+        resolved_host = tristan::network::Resolver::_getAddressInfo(p_host);
+        if (resolved_host.error) {
+            auto dns_resolved_host = tristan::network::Resolver::_queryDns(p_host, ttl);
+            if (not dns_resolved_host.addresses.empty()) {
+                resolved_host = std::move(dns_resolved_host);
+            }
+        }
+    } catch (const std::exception& p_exception) {
+        netError(p_exception.what());
+        resolved_host = ResolvedHost{{}, tristan::network::makeError(tristan::network::UrlErrors::NO_RECOVERY_ERROR)};
+        ttl = std::chrono::seconds(0);
+    }
+    if (ttl.count() == 0) {
+        std::scoped_lock< std::mutex > lock(m_lock);
+        ttl = resolved_host.error ? m_negative_ttl : m_default_ttl;
+    }
+    if (resolved_host.error) {
+        netError("Failed to resolve " + p_host + ": " + resolved_host.error.message());
+    }
+    {
+        std::scoped_lock< std::mutex > lock(m_lock);
+        auto cached_host = m_cache.find(p_host);
+        //Entry might have been removed by clearCache() or addHostEntry() or replaced by a newer lookup.
+        if (cached_host != m_cache.end() && cached_host->second.expiry == std::chrono::steady_clock::time_point::max()) {
+            if (ttl.count() == 0) {
+                m_cache.erase(cached_host);
+            } else {
+                cached_host->second.expiry = std::chrono::steady_clock::now() + ttl;
+            }
+        }
+    }
+    tristan::network::Resolver::_complete(p_host, p_result, std::move(resolved_host));
+}
+
+void tristan::network::Resolver::_complete(const std::string& p_host,
+                                           const std::shared_ptr< std::promise< ResolvedHost > >& p_result,
+                                           ResolvedHost&& p_resolved_host) {
+    p_result->set_value(std::move(p_resolved_host));
+    std::vector< std::function< void() > > waiters;
+    {
+        std::scoped_lock< std::mutex > lock(m_lock);
+        if (auto host_waiters = m_waiters.find(p_host); host_waiters != m_waiters.end()) {
+            waiters.swap(host_waiters->second);
+            m_waiters.erase(host_waiters);
+        }
+    }
+    for (const auto& waiter: waiters) {
+        waiter();
+    }
+}
+
+auto tristan::network::Resolver::_queryDns(const std::string& p_host, std::chrono::seconds& p_ttl) -> ResolvedHost {
+    thread_local struct __res_state resolver_state {};
+    thread_local bool resolver_state_initialised = false;
+    if (not resolver_state_initialised) {
+        if (res_ninit(&resolver_state) != 0) {
+            return {};
+        }
+        resolver_state_initialised = true;
+    }
+    ResolvedHost resolved_host;
+    auto lowest_ttl = std::numeric_limits< uint32_t >::max();
+    std::array< uint8_t, NS_PACKETSZ * 4 > answer{};
+    for (auto record_type: {ns_t_a, ns_t_aaaa}) {
+        auto answer_size = res_nsearch(&resolver_state, p_host.c_str(), ns_c_in, record_type, answer.data(), static_cast< int >(answer.size()));
+        if (answer_size < 0) {
+            continue;
+        }
+        ns_msg message;
+        if (ns_initparse(answer.data(), std::min(answer_size, static_cast< int >(answer.size())), &message) != 0) {
+            continue;
+        }
+        auto records_count = ns_msg_count(message, ns_s_an);
+        for (uint16_t index = 0; index < records_count; ++index) {
+            ns_rr record;
+            if (ns_parserr(&message, ns_s_an, index, &record) != 0) {
+                continue;
+            }
+            IP ip;
+            if (ns_rr_type(record) == ns_t_a && ns_rr_rdlen(record) == 4) {
+                std::memcpy(&ip.as_int, ns_rr_rdata(record), 4);
+                ip.as_string = tristan::network::utility::uint32_tIpToStringIp(ip.as_int);
+            } else if (ns_rr_type(record) == ns_t_aaaa && ns_rr_rdlen(record) == 16) {
+                std::memcpy(ip.as_ipv6.data(), ns_rr_rdata(record), 16);
+                ip.is_ipv6 = true;
+                ip.as_string = ipv6ToString(ip.as_ipv6);
+            } else {
+                //CNAME records are part of the answer as well, their time to live bounds the result.
+                lowest_ttl = std::min(lowest_ttl, static_cast< uint32_t >(ns_rr_ttl(record)));
+                continue;
+            }
+            if (ip.as_string.empty()) {
+                continue;
+            }
+            lowest_ttl = std::min(lowest_ttl, static_cast< uint32_t >(ns_rr_ttl(record)));
+            netInfo("Host was resolved to " + ip.as_string);
+            resolved_host.addresses.emplace_back(std::move(ip));
+        }
+    }
+    if (not resolved_host.addresses.empty()) {
+        p_ttl = std::chrono::seconds(lowest_ttl);
+    }
+    return resolved_host;
+}
+
+auto tristan::network::Resolver::_getAddressInfo(const std::string& p_host) -> ResolvedHost {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* address_info = nullptr;
+    auto status = getaddrinfo(p_host.c_str(), nullptr, &hints, &address_info);
+    if (status != 0) {
+        return ResolvedHost{{}, addressInfoError(status)};
+    }
+    ResolvedHost resolved_host;
+    std::vector< IP > ipv6_addresses;
+    for (auto* address = address_info; address != nullptr; address = address->ai_next) {
+        IP ip;
+        if (address->ai_family == AF_INET) {
+            ip.as_int = reinterpret_cast< sockaddr_in* >(address->ai_addr)->sin_addr.s_addr;
+            ip.as_string = tristan::network::utility::uint32_tIpToStringIp(ip.as_int);
+        } else if (address->ai_family == AF_INET6) {
+            std::memcpy(ip.as_ipv6.data(), &reinterpret_cast< sockaddr_in6* >(address->ai_addr)->sin6_addr, 16);
+            ip.is_ipv6 = true;
+            ip.as_string = ipv6ToString(ip.as_ipv6);
+        } else {
+            continue;
+        }
+        if (ip.as_string.empty()) {
+            resolved_host.error = tristan::network::makeError(tristan::network::UrlErrors::IP_CONVERTER_ERROR);
+            break;
+        }
+        netInfo("Host was resolved to " + ip.as_string);
+        if (ip.is_ipv6) {
+            ipv6_addresses.emplace_back(std::move(ip));
+        } else {
+            resolved_host.addresses.emplace_back(std::move(ip));
+        }
+    }
+    freeaddrinfo(address_info);
+    //IPv4 addresses go first so that hostIP() stays IPv4 when there is one.
+    std::move(ipv6_addresses.begin(), ipv6_addresses.end(), std::back_inserter(resolved_host.addresses));
+    if (resolved_host.addresses.empty() && not resolved_host.error) {
+        resolved_host.error = tristan::network::makeError(tristan::network::UrlErrors::NO_DATA_ERROR);
+    }
+    return resolved_host;
+}
@@ -0,0 +1,141 @@
+#include "segmented_buffer.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    /**
+     * \class SegmentPool
+     * \brief Keeps free segments so that large downloads do not hit the allocator for every segment.
+     * \Threadsafe Yes
+     */
+    class SegmentPool {
+    public:
+        static auto instance() -> SegmentPool& {
+            static SegmentPool pool;
+            return pool;
+        }
+
+        auto acquire() -> std::unique_ptr< uint8_t[] > {
+            {
+                std::scoped_lock< std::mutex > lock(m_lock);
+                if (not m_free_segments.empty()) {
+                    auto segment = std::move(m_free_segments.back());
+                    m_free_segments.pop_back();
+                    return segment;
+                }
+            }
+            return std::make_unique_for_overwrite< uint8_t[] >(tristan::network::SegmentedBuffer::segment_size);
+        }
+
+        void release(std::vector< std::unique_ptr< uint8_t[] > >& p_segments) {
+            std::scoped_lock< std::mutex > lock(m_lock);
+            auto capacity = m_capacity.load(std::memory_order_relaxed);
+            for (auto& segment: p_segments) {
+                if (m_free_segments.size() >= capacity) {
+                    break;
+                }
+                m_free_segments.emplace_back(std::move(segment));
+            }
+            p_segments.clear();
+        }
+
+        void setCapacity(uint32_t p_count) {
+            m_capacity.store(p_count, std::memory_order_relaxed);
+            std::scoped_lock< std::mutex > lock(m_lock);
+            if (m_free_segments.size() > p_count) {
+                m_free_segments.resize(p_count);
+            }
+        }
+
+    private:
+        SegmentPool() = default;
+
+        std::vector< std::unique_ptr< uint8_t[] > > m_free_segments;
+        std::mutex m_lock;
+        std::atomic< uint32_t > m_capacity{256};
+    };
+
+}  //End of unnamed namespace
+
+auto tristan::network::SegmentedBuffer::operator=(SegmentedBuffer&& p_other) noexcept -> SegmentedBuffer& {
+    if (this != &p_other) {
+        tristan::network::SegmentedBuffer::clear();
+        m_segments = std::move(p_other.m_segments);
+        m_last_segment_size = p_other.m_last_segment_size;
+        p_other.m_last_segment_size = 0;
+    }
+    return *this;
+}
+
+tristan::network::SegmentedBuffer::~SegmentedBuffer() { tristan::network::SegmentedBuffer::clear(); }
+
+void tristan::network::SegmentedBuffer::setPoolCapacity(uint32_t p_count) { SegmentPool::instance().setCapacity(p_count); }
+
+void tristan::network::SegmentedBuffer::append(std::span< const uint8_t > p_data) {
+    while (not p_data.empty()) {
+        auto tail = tristan::network::SegmentedBuffer::writableTail(p_data.size());
+        std::memcpy(tail.data(), p_data.data(), tail.size());
+        tristan::network::SegmentedBuffer::commit(tail.size());
+        p_data = p_data.subspan(tail.size());
+    }
+}
+
+auto tristan::network::SegmentedBuffer::writableTail(uint64_t p_max_size) -> std::span< uint8_t > {
+    if (m_segments.empty() || m_last_segment_size == segment_size) {
+        m_segments.emplace_back(SegmentPool::instance().acquire());
+        m_last_segment_size = 0;
+    }
+    return {m_segments.back().get() + m_last_segment_size, std::min(p_max_size, segment_size - m_last_segment_size)};
+}
+
+void tristan::network::SegmentedBuffer::commit(uint64_t p_size) { m_last_segment_size += p_size; }
+
+void tristan::network::SegmentedBuffer::clear() {
+    if (not m_segments.empty()) {
+        SegmentPool::instance().release(m_segments);
+    }
+    m_last_segment_size = 0;
+}
+
+auto tristan::network::SegmentedBuffer::size() const noexcept -> uint64_t {
+    if (m_segments.empty()) {
+        return 0;
+    }
+    return (m_segments.size() - 1) * segment_size + m_last_segment_size;
+}
+
+auto tristan::network::SegmentedBuffer::empty() const noexcept -> bool { return tristan::network::SegmentedBuffer::size() == 0; }
+
+auto tristan::network::SegmentedBuffer::segments() const -> std::vector< std::span< const uint8_t > > {
+    std::vector< std::span< const uint8_t > > segments;
+    segments.reserve(m_segments.size());
+    for (size_t index = 0; index < m_segments.size(); ++index) {
+        auto segment_data_size = (index + 1 == m_segments.size() ? m_last_segment_size : segment_size);
+        if (segment_data_size != 0) {
+            segments.emplace_back(m_segments.at(index).get(), segment_data_size);
+        }
+    }
+    return segments;
+}
+
+auto tristan::network::SegmentedBuffer::iovecs() const -> std::vector< iovec > {
+    std::vector< iovec > iovecs;
+    iovecs.reserve(m_segments.size());
+    for (const auto& segment: tristan::network::SegmentedBuffer::segments()) {
+        iovecs.push_back({const_cast< uint8_t* >(segment.data()), segment.size()});
+    }
+    return iovecs;
+}
+
+auto tristan::network::SegmentedBuffer::contiguous() const -> std::vector< uint8_t > {
+    std::vector< uint8_t > data;
+    data.reserve(tristan::network::SegmentedBuffer::size());
+    for (const auto& segment: tristan::network::SegmentedBuffer::segments()) {
+        data.insert(data.end(), segment.begin(), segment.end());
+    }
+    return data;
+}
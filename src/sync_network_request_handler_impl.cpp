@@ -1,46 +1,60 @@
 #include "sync_network_request_handler_impl.hpp"
 #include "network_logger.hpp"
 #include "http_response.hpp"
+#include "tls_session_cache.hpp"
+#include "connection_pool.hpp"
+#include "connection_race.hpp"
+#include "file_body_sender.hpp"
 
 #include <socket_error.hpp>
 
+#include <charconv>
 #include <thread>
 
-tristan::network::private_::SyncNetworkRequestHandlerImpl::SyncNetworkRequestHandlerImpl() = default;
+tristan::network::private_::SyncNetworkRequestHandlerImpl::SyncNetworkRequestHandlerImpl(uint8_t p_workers_count, uint16_t p_queue_limit) :
+    m_workers(p_workers_count, p_queue_limit) { }
 
 tristan::network::private_::SyncNetworkRequestHandlerImpl::~SyncNetworkRequestHandlerImpl() = default;
+
 void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleRequest(std::shared_ptr< NetworkRequestBase >&& p_network_request) {
+    bool submitted = true;
     if (auto tcp_ptr = std::dynamic_pointer_cast< tristan::network::TcpRequest >(p_network_request)) {
-        std::thread(&SyncNetworkRequestHandlerImpl::handleTcpRequest, this, std::move(tcp_ptr)).detach();
+        submitted = m_workers.submit([this, tcp_ptr]() mutable -> void {
+            SyncNetworkRequestHandlerImpl::handleTcpRequest(std::move(tcp_ptr));
+        });
     } else if (auto http_ptr = std::dynamic_pointer_cast< tristan::network::HttpRequest >(p_network_request)){
-        std::thread(&SyncNetworkRequestHandlerImpl::handleHttpRequest, this, std::move(http_ptr)).detach();
+        submitted = m_workers.submit([this, http_ptr]() mutable -> void {
+            SyncNetworkRequestHandlerImpl::handleHttpRequest(std::move(http_ptr));
+        });
     } else {
         this->handleUnimplementedRequest(std::move(p_network_request));
     }
+    if (not submitted) {
+        netError("Sync request handler was stopped");
+        p_network_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::ErrorCode::REQUEST_HANDLER_STOPPED));
+    }
 }
 
+void tristan::network::private_::SyncNetworkRequestHandlerImpl::stop() { m_workers.stop(false); }
+
 // NOLINTNEXTLINE
 void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest(std::shared_ptr< TcpRequest >&& p_tcp_request) {
     netTrace("Start");
     netInfo("Starting processing of request " + p_tcp_request->uuid());
 
-    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_tcp_request);
-
-    tristan::sockets::InetSocket socket;
-
-    if (socket.error()) {
-        netError(socket.error().message());
-        p_tcp_request->request_handlers_api.setError(socket.error());
+    if (not tristan::network::private_::NetworkRequestHandlerImpl::checkHostResolved(p_tcp_request)) {
         return;
     }
 
+    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_tcp_request);
+
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
 
-    socket.setHost(p_tcp_request->url().hostIP().as_int, p_tcp_request->url().host());
-    socket.setPort(p_tcp_request->url().portUint16_t_network_byte_order());
-    socket.setNonBlocking();
-    auto start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (not socket.connected()) {
+    auto total_deadline = tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_tcp_request);
+    auto deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->connectTimeOut(), total_deadline);
+    tristan::network::private_::ConnectionRace race(
+        p_tcp_request->url().hostIPList(), p_tcp_request->url().portUint16_t_network_byte_order(), p_tcp_request->url().host(), false);
+    while (not race.advance()) {
         if (p_tcp_request->isPaused()) {
             netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
             return;
@@ -49,26 +63,28 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest
             netInfo("Network request is cancelled tcp_request->uuid() = " + p_tcp_request->uuid());
             return;
         }
-        netInfo("Connecting to " + p_tcp_request->url().hostIP().as_string);
-        netDebug("tcp_request->uuid() = " + p_tcp_request->uuid());
-
-        socket.connect();
-
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+        if (race.failed()) {
+            netError(race.error().message());
+            p_tcp_request->request_handlers_api.setError(race.error());
             return;
         }
-        if (not socket.connected()) {
-            socket.resetError();
-            netDebug("Sleeping on connect");
-            std::this_thread::sleep_for(std::chrono::milliseconds(m_sleeping_interval));
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_tcp_request);
+            return;
         }
+        netDebug("Sleeping on connect");
+        std::this_thread::sleep_until(std::min({now + m_sleeping_interval, race.nextAttemptTime(), deadline}));
     }
+    auto socket_ptr = race.winner();
+    auto& socket = *socket_ptr;
 
     uint64_t bytes_written = 0;
-    uint64_t bytes_to_write = p_tcp_request->requestData().size();
+    auto request_buffers = p_tcp_request->requestBuffers();
+    uint64_t bytes_to_write = tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(request_buffers);
 
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::WRITING);
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
     while (bytes_written < bytes_to_write) {
         if (p_tcp_request->isPaused()) {
             netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
@@ -80,9 +96,13 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest
         }
         netInfo("Writing to " + p_tcp_request->url().hostIP().as_string);
         auto bytes_remain = bytes_to_write - bytes_written;
-        uint16_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-        bytes_written += socket.write(p_tcp_request->requestData(), current_frame_size, bytes_written);
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+        uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(p_tcp_request), bytes_remain);
+        auto frame_bytes_written = socket.writev(request_buffers, current_frame_size, bytes_written);
+        if (frame_bytes_written != 0) {
+            bytes_written += frame_bytes_written;
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
+        }
+        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_tcp_request)) {
             return;
         }
         if (socket.error()) {
@@ -93,9 +113,10 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest
     }
 
     if (p_tcp_request->bytesToRead() != 0) {
+        p_tcp_request->request_handlers_api.reserveResponseData(p_tcp_request->bytesToRead());
         uint64_t bytes_read = 0;
         uint64_t bytes_to_read = p_tcp_request->bytesToRead();
-        start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->firstByteTimeOut(), total_deadline);
         while (bytes_read < bytes_to_read) {
             if (p_tcp_request->isPaused()) {
                 netInfo("Network request is paused tcp_request->uuid() = " + p_tcp_request->uuid());
@@ -106,17 +127,16 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest
                 return;
             }
             auto bytes_remain = bytes_to_read - bytes_read;
-            uint16_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-            auto data = socket.read(current_frame_size);
+            uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_tcp_request), bytes_remain);
+            auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readResponseData(socket, p_tcp_request, current_frame_size);
 
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_tcp_request)) {
+            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_tcp_request)) {
                 return;
             }
-            if (not data.empty()) {
-                netDebug("data.size() = " + std::to_string(data.size()));
-                netDebug("data = " + std::string(data.begin(), data.end()));
-                bytes_read += data.size();
-                p_tcp_request->request_handlers_api.addResponseData(std::move(data));
+            if (frame_bytes_read != 0) {
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_tcp_request->idleTimeOut(), total_deadline);
+                netDebug("frame_bytes_read = " + std::to_string(frame_bytes_read));
+                bytes_read += frame_bytes_read;
                 if (p_tcp_request->error()) {
                     netError(p_tcp_request->error().message());
                     return;
@@ -130,6 +150,10 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleTcpRequest
         }
     }
 
+    if (p_tcp_request->isSSL()) {
+        tristan::network::private_::TlsSessionCache::instance().store(
+            p_tcp_request->url().host(), p_tcp_request->url().portUint16_t_network_byte_order(), socket);
+    }
     p_tcp_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
     netInfo("Request " + p_tcp_request->uuid() + " successfully processed");
 
@@ -142,48 +166,54 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
 
     netInfo("Starting processing of HTTP request " + p_http_request->uuid());
 
-    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_http_request);
-
-    tristan::sockets::InetSocket socket;
-
-    if (socket.error()) {
-        netError(socket.error().message());
-        p_http_request->request_handlers_api.setError(socket.error());
+    if (not tristan::network::private_::NetworkRequestHandlerImpl::checkHostResolved(p_http_request)) {
         return;
     }
 
-    p_http_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
+    tristan::network::private_::NetworkRequestHandlerImpl::debugNetworkRequestInfo(p_http_request);
 
-    socket.setHost(p_http_request->url().hostIP().as_int, p_http_request->url().host());
-    socket.setPort(p_http_request->url().portUint16_t_network_byte_order());
-    socket.setNonBlocking();
-    auto start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-    while (not socket.connected()) {
-        if (p_http_request->isPaused()) {
-            netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
-            return;
-        }
-        if (p_http_request->isCanceled()) {
-            netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
-            return;
-        }
-        netInfo("Connecting to " + p_http_request->url().hostIP().as_string);
-        socket.connect(p_http_request->isSSL());
+    tristan::network::private_::ConnectionPool::Key connection_key{
+        p_http_request->url().host(), p_http_request->url().portUint16_t_network_byte_order(), p_http_request->isSSL()};
+    auto socket_ptr = tristan::network::private_::ConnectionPool::instance().acquire(connection_key);
 
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-            return;
-        }
-        if (socket.error()) {
-            socket.resetError();
+    p_http_request->request_handlers_api.setStatus(tristan::network::Status::PROCESSED);
+
+    auto total_deadline = tristan::network::private_::NetworkRequestHandlerImpl::totalDeadline(p_http_request);
+    auto deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->connectTimeOut(), total_deadline);
+    if (not socket_ptr) {
+        tristan::network::private_::ConnectionRace race(
+            p_http_request->url().hostIPList(), p_http_request->url().portUint16_t_network_byte_order(), p_http_request->url().host(), p_http_request->isSSL());
+        while (not race.advance()) {
+            if (p_http_request->isPaused()) {
+                netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+                return;
+            }
+            if (p_http_request->isCanceled()) {
+                netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+                return;
+            }
+            if (race.failed()) {
+                netError(race.error().message());
+                p_http_request->request_handlers_api.setError(race.error());
+                return;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                return;
+            }
             netDebug("Sleeping on connect");
-            std::this_thread::sleep_for(m_sleeping_interval);
+            std::this_thread::sleep_until(std::min({now + m_sleeping_interval, race.nextAttemptTime(), deadline}));
         }
+        socket_ptr = race.winner();
     }
+    auto& socket = *socket_ptr;
 
     uint64_t bytes_written = 0;
-    uint64_t bytes_to_write = p_http_request->requestData().size();
+    auto request_buffers = p_http_request->requestBuffers();
+    uint64_t bytes_to_write = tristan::network::private_::NetworkRequestHandlerImpl::buffersSize(request_buffers);
     p_http_request->request_handlers_api.setStatus(tristan::network::Status::WRITING);
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
     while (bytes_written < bytes_to_write) {
         if (p_http_request->isPaused()) {
             netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
@@ -195,9 +225,13 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
         }
         netInfo("Writing to " + p_http_request->url().hostIP().as_string);
         auto bytes_remain = bytes_to_write - bytes_written;
-        uint16_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-        bytes_written += socket.write(p_http_request->requestData(), current_frame_size, bytes_written);
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+        uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(p_http_request), bytes_remain);
+        auto frame_bytes_written = socket.writev(request_buffers, current_frame_size, bytes_written);
+        if (frame_bytes_written != 0) {
+            bytes_written += frame_bytes_written;
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+        }
+        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
             return;
         }
         if (socket.error()) {
@@ -208,9 +242,41 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
         netDebug(std::to_string(current_frame_size) + " bytes was written");
     }
 
+    if (const auto& body_file = p_http_request->bodyFile()) {
+        tristan::network::private_::FileBodySender body_sender(socket, body_file.value());
+        while (not body_sender.done()) {
+            if (p_http_request->isPaused()) {
+                netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
+                return;
+            }
+            if (p_http_request->isCanceled()) {
+                netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
+                return;
+            }
+            auto frame_bytes_sent = body_sender.send(tristan::network::private_::NetworkRequestHandlerImpl::writeFrameSize(p_http_request));
+            if (body_sender.error()) {
+                netError(body_sender.error().message());
+                p_http_request->request_handlers_api.setError(body_sender.error());
+                return;
+            }
+            if (frame_bytes_sent != 0) {
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                netDebug(std::to_string(frame_bytes_sent) + " bytes of body file was sent");
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                tristan::network::private_::NetworkRequestHandlerImpl::setTimedOut(p_http_request);
+                return;
+            }
+            if (body_sender.wouldBlock()) {
+                netDebug("Sleeping on write");
+                std::this_thread::sleep_for(m_sleeping_interval);
+            }
+        }
+    }
+
     p_http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
-    std::vector<uint8_t> headers_data;
-    start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+    tristan::network::HttpResponseParser response_parser;
+    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->firstByteTimeOut(), total_deadline);
     while (true) {
         if (p_http_request->isPaused()) {
             netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
@@ -221,14 +287,20 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
             return;
         }
         auto data = socket.readUntil({'\r', '\n', '\r', '\n'});
-        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+        if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
             return;
         }
         if (socket.error() && socket.error().value() != static_cast< int >(tristan::sockets::Error::READ_DONE)) {
             if (not data.empty()) {
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
                 netDebug(std::to_string(data.size()) + " bytes was read");
                 netDebug("Data: " + std::string(data.begin(), data.end()));
-                headers_data.insert(headers_data.end(), data.begin(), data.end());
+                static_cast< void >(response_parser.consume(data));
+                if (response_parser.failed()) {
+                    netError(response_parser.error().message());
+                    p_http_request->request_handlers_api.setError(response_parser.error());
+                    return;
+                }
             }
             socket.resetError();
             netDebug("Sleeping on read until");
@@ -238,9 +310,14 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
         if (not data.empty()) {
             netDebug(std::to_string(data.size()) + " bytes was read");
             netDebug("Data: " + std::string(data.begin(), data.end()));
-            headers_data.insert(headers_data.end(), data.begin(), data.end());
+            static_cast< void >(response_parser.consume(data));
+            if (response_parser.failed()) {
+                netError(response_parser.error().message());
+                p_http_request->request_handlers_api.setError(response_parser.error());
+                return;
+            }
         }
-        p_http_request->initResponse(std::move(headers_data));
+        p_http_request->initResponse(response_parser);
         if (p_http_request->error()) {
             netError(p_http_request->error().message());
             return;
@@ -253,20 +330,35 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
         netFatal("Bad dynamic cast");
         throw std::bad_cast();
     }
+    //TLS 1.3 session tickets are sent after the handshake, hence the session is stored once the server responded.
+    if (p_http_request->isSSL()) {
+        tristan::network::private_::TlsSessionCache::instance().store(
+            p_http_request->url().host(), p_http_request->url().portUint16_t_network_byte_order(), socket);
+    }
     if (response->status() != tristan::network::HttpStatus::Ok) {
         p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
         return;
     }
 
-    if (auto content_length = response->headers()->headerValue(tristan::network::http::header_names::content_length)) {
-        p_http_request->setBytesToRead(std::stoll(content_length.value()));
+    if (auto content_length = response->headers()->value(tristan::network::http::HeaderId::CONTENT_LENGTH)) {
+        uint64_t content_length_value = 0;
+        const auto* content_length_end = content_length->data() + content_length->size();
+        auto result = std::from_chars(content_length->data(), content_length_end, content_length_value);
+        if (result.ec != std::errc() || result.ptr != content_length_end) {
+            //Body size is unknown, hence the connection is not reused since unread body would be taken for the next response.
+            netError("Bad Content-Length header value: " + std::string(content_length.value()));
+            p_http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR));
+            return;
+        }
+        p_http_request->setBytesToRead(content_length_value);
         netInfo("Content-length header found");
         if (p_http_request->bytesToRead() != 0) {
             socket.resetError();
             p_http_request->request_handlers_api.setStatus(tristan::network::Status::READING);
+            p_http_request->request_handlers_api.reserveResponseData(p_http_request->bytesToRead());
             uint64_t bytes_read = 0;
             uint64_t bytes_to_read = p_http_request->bytesToRead();
-            start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
+            deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
             while (bytes_read < bytes_to_read) {
                 if (p_http_request->isPaused()) {
                     netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
@@ -277,16 +369,15 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
                     return;
                 }
                 auto bytes_remain = bytes_to_read - bytes_read;
-                //ERROR: uint8_t should be changed to uint16_t according to m_max_frame_size
-                uint16_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-                auto data = socket.read(current_frame_size);
-                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+                uint16_t current_frame_size = std::min< uint64_t >(tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_http_request), bytes_remain);
+                auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readResponseData(socket, p_http_request, current_frame_size);
+                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
                     return;
                 }
-                if (not data.empty()) {
-                    netDebug(std::to_string(data.size()) + " bytes was read from " + p_http_request->url().hostIP().as_string);
-                    bytes_read += data.size();
-                    p_http_request->request_handlers_api.addResponseData(std::move(data));
+                if (frame_bytes_read != 0) {
+                    deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                    netDebug(std::to_string(frame_bytes_read) + " bytes was read from " + p_http_request->url().hostIP().as_string);
+                    bytes_read += frame_bytes_read;
                     if (p_http_request->error()) {
                         netError(p_http_request->error().message());
                         return;
@@ -300,16 +391,19 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
             }
         } else {
             netWarning("Content length header contained 0 value");
-            p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
         }
-    } else if (auto transfer_encoding = response->headers()->headerValue(tristan::network::http::header_names::transfer_encoding)) {
+        tristan::network::private_::ConnectionPool::instance().release(connection_key, std::move(socket_ptr), *response);
+    } else if (auto transfer_encoding = response->headers()->value(tristan::network::http::HeaderId::TRANSFER_ENCODING)) {
         netInfo("Transfer-encoding header found");
         if (transfer_encoding.value().find("chunked") == std::string::npos) {
             netWarning("Transfer-encoding header does not contain chunked specification.");
             p_http_request->request_handlers_api.setStatus(tristan::network::Status::DONE);
             return;
         }
-        while (true) {
+        deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+        socket.resetError();
+        tristan::network::HttpChunkedDecoder chunked_decoder;
+        while (not chunked_decoder.done()) {
             if (p_http_request->isPaused()) {
                 netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
                 return;
@@ -318,57 +412,18 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
                 netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
                 return;
             }
-            auto chunk_size = socket.readUntil({'\r', '\n'});
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+            auto frame_bytes_read = tristan::network::private_::NetworkRequestHandlerImpl::readChunkedResponseData(
+                socket, p_http_request, chunked_decoder, tristan::network::private_::NetworkRequestHandlerImpl::readFrameSize(p_http_request));
+            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, deadline, p_http_request)) {
                 return;
             }
-            if (socket.error() && socket.error().value() != static_cast< int >(tristan::sockets::Error::READ_DONE)) {
-                socket.resetError();
-                netDebug("Sleeping on read until");
-                std::this_thread::sleep_for(m_sleeping_interval);
-                continue;
-            }
-            auto pos = std::find(chunk_size.begin(), chunk_size.end(), ';');
-            uint64_t bytes_to_read = std::stoll(std::string(chunk_size.begin(), pos), nullptr, 16);
-            if (bytes_to_read == 0) {
-                break;
-            }
-            socket.resetError();
-            uint64_t bytes_read = 0;
-            start = std::chrono::time_point_cast< std::chrono::microseconds >(std::chrono::system_clock::now());
-            while (bytes_read < bytes_to_read) {
-                if (p_http_request->isPaused()) {
-                    netInfo("Network request is paused http_request->uuid() = " + p_http_request->uuid());
-                    return;
-                }
-                if (p_http_request->isCanceled()) {
-                    netInfo("Network request is cancelled http_request->uuid() = " + p_http_request->uuid());
-                    return;
-                }
-                auto bytes_remain = bytes_to_read - bytes_read;
-                uint16_t current_frame_size = (m_max_frame_size < bytes_remain ? m_max_frame_size : bytes_remain);
-                auto data = socket.read(current_frame_size);
-                if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
+            if (frame_bytes_read != 0) {
+                deadline = tristan::network::private_::NetworkRequestHandlerImpl::deadline(p_http_request->idleTimeOut(), total_deadline);
+                netDebug(std::to_string(frame_bytes_read) + " bytes was read from " + p_http_request->url().hostIP().as_string);
+                if (p_http_request->error()) {
+                    netError(p_http_request->error().message());
                     return;
                 }
-                if (not data.empty()) {
-                    netDebug(std::to_string(data.size()) + " bytes was read from " + p_http_request->url().hostIP().as_string);
-                    bytes_read += data.size();
-                    p_http_request->request_handlers_api.addResponseData(std::move(data));
-                    if (p_http_request->error()) {
-                        netError(p_http_request->error().message());
-                        return;
-                    }
-                }
-                if (socket.error()) {
-                    socket.resetError();
-                    netDebug("Sleeping on read");
-                    std::this_thread::sleep_for(std::chrono::milliseconds(m_sleeping_interval));
-                }
-            }
-            auto redundant_data = socket.read(2);
-            if (not tristan::network::private_::NetworkRequestHandlerImpl::checkSocketOperationErrorAndTimeOut(socket, start, p_http_request)) {
-                return;
             }
             if (socket.error()) {
                 socket.resetError();
@@ -376,6 +431,8 @@ void tristan::network::private_::SyncNetworkRequestHandlerImpl::handleHttpReques
                 std::this_thread::sleep_for(std::chrono::milliseconds(m_sleeping_interval));
             }
         }
+        tristan::network::private_::NetworkRequestHandlerImpl::addTrailers(*response, chunked_decoder);
+        tristan::network::private_::ConnectionPool::instance().release(connection_key, std::move(socket_ptr), *response);
     } else {
         p_http_request->request_handlers_api.setError(tristan::network::makeError(tristan::network::NetworkResponseError::HTTP_RESPONSE_SIZE_ERROR));
         return;
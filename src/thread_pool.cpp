@@ -0,0 +1,70 @@
+#include "thread_pool.hpp"
+#include "network_logger.hpp"
+
+tristan::network::private_::ThreadPool::ThreadPool(uint8_t p_workers_count, uint16_t p_queue_limit) :
+    m_queue_limit(p_queue_limit == 0 ? 1 : p_queue_limit),
+    m_stopped(false),
+    m_drain(false) {
+    if (p_workers_count == 0) {
+        netWarning("Workers count can not be 0 - 1 worker will be used");
+        p_workers_count = 1;
+    }
+    m_workers.reserve(p_workers_count);
+    for (uint8_t index = 0; index < p_workers_count; ++index) {
+        m_workers.emplace_back(&ThreadPool::_work, this);
+    }
+}
+
+tristan::network::private_::ThreadPool::~ThreadPool() { tristan::network::private_::ThreadPool::stop(false); }
+
+auto tristan::network::private_::ThreadPool::submit(std::function< void() >&& p_job) -> bool {
+    std::unique_lock< std::mutex > lock(m_jobs_lock);
+    m_job_taken.wait(lock, [this]() -> bool {
+        return m_stopped || m_jobs.size() < m_queue_limit;
+    });
+    if (m_stopped) {
+        return false;
+    }
+    m_jobs.emplace(std::move(p_job));
+    lock.unlock();
+    m_job_added.notify_one();
+    return true;
+}
+
+void tristan::network::private_::ThreadPool::stop(bool p_drain) {
+    {
+        std::scoped_lock< std::mutex > lock(m_jobs_lock);
+        if (not m_stopped) {
+            m_stopped = true;
+            m_drain = p_drain;
+            if (not m_drain) {
+                netInfo("Discarding " + std::to_string(m_jobs.size()) + " queued jobs");
+                m_jobs = {};
+            }
+        }
+    }
+    m_job_added.notify_all();
+    m_job_taken.notify_all();
+    for (auto& worker: m_workers) {
+        if (worker.joinable() && worker.get_id() != std::this_thread::get_id()) {
+            worker.join();
+        }
+    }
+}
+
+void tristan::network::private_::ThreadPool::_work() {
+    while (true) {
+        std::unique_lock< std::mutex > lock(m_jobs_lock);
+        m_job_added.wait(lock, [this]() -> bool {
+            return m_stopped || not m_jobs.empty();
+        });
+        if (m_jobs.empty() || (m_stopped && not m_drain)) {
+            return;
+        }
+        auto job = std::move(m_jobs.front());
+        m_jobs.pop();
+        lock.unlock();
+        m_job_taken.notify_one();
+        job();
+    }
+}
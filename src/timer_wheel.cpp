@@ -0,0 +1,136 @@
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+
+tristan::network::private_::TimerWheel::TimerWheel() :
+    m_slots(),
+    m_origin(std::chrono::steady_clock::now()),
+    m_current_tick(0),
+    m_timers_count(0) { }
+
+tristan::network::private_::TimerWheel::~TimerWheel() {
+    for (auto& level: m_slots) {
+        for (auto* timer: level) {
+            while (timer != nullptr) {
+                auto* next = timer->m_next;
+                timer->m_wheel = nullptr;
+                timer->m_slot = nullptr;
+                timer->m_next = nullptr;
+                timer->m_prev = nullptr;
+                timer = next;
+            }
+        }
+    }
+}
+
+void tristan::network::private_::TimerWheel::schedule(Timer& p_timer, std::chrono::steady_clock::time_point p_expiry) {
+    if (p_timer.m_wheel != nullptr) {
+        p_timer.m_wheel->cancel(p_timer);
+    }
+    //Timer never expires on the tick which is being processed, hence the earliest expiry is the next tick.
+    p_timer.m_expiry_tick = std::max(tristan::network::private_::TimerWheel::_tick(p_expiry), m_current_tick + 1);
+    p_timer.m_wheel = this;
+    tristan::network::private_::TimerWheel::_insert(p_timer);
+    ++m_timers_count;
+}
+
+void tristan::network::private_::TimerWheel::cancel(Timer& p_timer) {
+    if (p_timer.m_wheel != this) {
+        return;
+    }
+    tristan::network::private_::TimerWheel::_unlink(p_timer);
+    p_timer.m_wheel = nullptr;
+    --m_timers_count;
+}
+
+void tristan::network::private_::TimerWheel::advance(std::chrono::steady_clock::time_point p_now, std::vector< Timer* >& p_expired) {
+    auto target_tick = tristan::network::private_::TimerWheel::_tick(p_now);
+    if (m_timers_count == 0) {
+        m_current_tick = std::max(m_current_tick, target_tick);
+        return;
+    }
+    while (m_current_tick < target_tick && m_timers_count > 0) {
+        ++m_current_tick;
+        //Upper levels are cascaded when the lower level wraps around.
+        for (uint8_t level = 1; level < levels; ++level) {
+            if ((m_current_tick & ((uint64_t{1} << (bits_per_level * level)) - 1)) != 0) {
+                break;
+            }
+            tristan::network::private_::TimerWheel::_cascade(level);
+        }
+        auto& slot = m_slots.at(0).at(m_current_tick & slot_mask);
+        while (slot != nullptr) {
+            auto* timer = slot;
+            tristan::network::private_::TimerWheel::_unlink(*timer);
+            timer->m_wheel = nullptr;
+            --m_timers_count;
+            p_expired.push_back(timer);
+        }
+    }
+    m_current_tick = std::max(m_current_tick, target_tick);
+}
+
+auto tristan::network::private_::TimerWheel::nextTimeout() const -> std::chrono::milliseconds {
+    if (m_timers_count == 0) {
+        return std::chrono::milliseconds(-1);
+    }
+    for (uint64_t delta = 1; delta <= slots_per_level - (m_current_tick & slot_mask); ++delta) {
+        if (m_slots.at(0).at((m_current_tick + delta) & slot_mask) != nullptr) {
+            return std::chrono::milliseconds(delta);
+        }
+    }
+    //Nothing expires before the next cascade.
+    return std::chrono::milliseconds(slots_per_level - (m_current_tick & slot_mask));
+}
+
+auto tristan::network::private_::TimerWheel::empty() const noexcept -> bool { return m_timers_count == 0; }
+
+auto tristan::network::private_::TimerWheel::_tick(std::chrono::steady_clock::time_point p_time_point) const -> uint64_t {
+    if (p_time_point <= m_origin) {
+        return 0;
+    }
+    return static_cast< uint64_t >(std::chrono::ceil< std::chrono::milliseconds >(p_time_point - m_origin).count());
+}
+
+void tristan::network::private_::TimerWheel::_insert(Timer& p_timer) {
+    //Deadlines beyond the range of the wheel are kept in the farthest slot and reinserted when it is cascaded.
+    auto tick = std::min(p_timer.m_expiry_tick, m_current_tick + wheel_range - 1);
+    auto delta = tick - m_current_tick;
+    uint8_t level = 0;
+    while (level < levels - 1 && delta >= (uint64_t{1} << (bits_per_level * (level + 1)))) {
+        ++level;
+    }
+    auto& slot = m_slots.at(level).at((tick >> (bits_per_level * level)) & slot_mask);
+    p_timer.m_slot = &slot;
+    p_timer.m_prev = nullptr;
+    p_timer.m_next = slot;
+    if (slot != nullptr) {
+        slot->m_prev = &p_timer;
+    }
+    slot = &p_timer;
+}
+
+void tristan::network::private_::TimerWheel::_unlink(Timer& p_timer) {
+    if (p_timer.m_prev != nullptr) {
+        p_timer.m_prev->m_next = p_timer.m_next;
+    } else {
+        *p_timer.m_slot = p_timer.m_next;
+    }
+    if (p_timer.m_next != nullptr) {
+        p_timer.m_next->m_prev = p_timer.m_prev;
+    }
+    p_timer.m_slot = nullptr;
+    p_timer.m_next = nullptr;
+    p_timer.m_prev = nullptr;
+}
+
+void tristan::network::private_::TimerWheel::_cascade(uint8_t p_level) {
+    auto& slot = m_slots.at(p_level).at((m_current_tick >> (bits_per_level * p_level)) & slot_mask);
+    auto* timer = slot;
+    slot = nullptr;
+    while (timer != nullptr) {
+        auto* next = timer->m_next;
+        tristan::network::private_::TimerWheel::_insert(*timer);
+        timer = next;
+    }
+}
@@ -0,0 +1,86 @@
+#include "tls_session_cache.hpp"
+#include "network_logger.hpp"
+
+#include <ctime>
+
+tristan::network::private_::TlsSessionCache::TlsSessionCache() :
+    m_capacity(256) { }
+
+auto tristan::network::private_::TlsSessionCache::instance() -> TlsSessionCache& {
+    static TlsSessionCache tls_session_cache;
+
+    return tls_session_cache;
+}
+
+void tristan::network::private_::TlsSessionCache::setCapacity(uint16_t p_capacity) {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_capacity = p_capacity;
+    while (m_sessions.size() > m_capacity) {
+        tristan::network::private_::TlsSessionCache::_erase(m_sessions.find(m_lru.front()));
+    }
+}
+
+void tristan::network::private_::TlsSessionCache::apply(const std::string& p_host, uint16_t p_port, tristan::sockets::InetSocket& p_socket) {
+    std::unique_ptr< SSL_SESSION, SessionDeleter > session;
+    {
+        std::scoped_lock< std::mutex > lock(m_lock);
+        auto session_iterator = m_sessions.find(Key(p_host, p_port));
+        if (session_iterator == m_sessions.end()) {
+            return;
+        }
+        auto* cached_session = session_iterator->second.m_session.get();
+        auto expiry = static_cast< time_t >(SSL_SESSION_get_time(cached_session) + SSL_SESSION_get_timeout(cached_session));
+        if (expiry <= std::time(nullptr)) {
+            tristan::network::private_::TlsSessionCache::_erase(session_iterator);
+            return;
+        }
+        if (SSL_SESSION_get_protocol_version(cached_session) == TLS1_3_VERSION) {
+            session = std::move(session_iterator->second.m_session);
+            tristan::network::private_::TlsSessionCache::_erase(session_iterator);
+        } else {
+            SSL_SESSION_up_ref(cached_session);
+            session.reset(cached_session);
+        }
+    }
+    netDebug("Resuming TLS session with " + p_host);
+    //Socket takes its own reference.
+    p_socket.setSslSession(session.get());
+}
+
+void tristan::network::private_::TlsSessionCache::store(const std::string& p_host, uint16_t p_port, const tristan::sockets::InetSocket& p_socket) {
+    auto* ssl = p_socket.ssl();
+    if (ssl == nullptr) {
+        return;
+    }
+    std::unique_ptr< SSL_SESSION, SessionDeleter > session(SSL_get1_session(ssl));
+    if (not session || SSL_SESSION_is_resumable(session.get()) == 0) {
+        return;
+    }
+    std::scoped_lock< std::mutex > lock(m_lock);
+    if (m_capacity == 0) {
+        return;
+    }
+    Key key(p_host, p_port);
+    auto session_iterator = m_sessions.find(key);
+    if (session_iterator != m_sessions.end()) {
+        session_iterator->second.m_session = std::move(session);
+        m_lru.splice(m_lru.end(), m_lru, session_iterator->second.m_position);
+        return;
+    }
+    if (m_sessions.size() >= m_capacity) {
+        tristan::network::private_::TlsSessionCache::_erase(m_sessions.find(m_lru.front()));
+    }
+    m_lru.push_back(key);
+    m_sessions.emplace(std::move(key), CachedSession{std::move(session), std::prev(m_lru.end())});
+}
+
+void tristan::network::private_::TlsSessionCache::clear() {
+    std::scoped_lock< std::mutex > lock(m_lock);
+    m_sessions.clear();
+    m_lru.clear();
+}
+
+void tristan::network::private_::TlsSessionCache::_erase(std::map< Key, CachedSession >::iterator p_session) {
+    m_lru.erase(p_session->second.m_position);
+    m_sessions.erase(p_session);
+}
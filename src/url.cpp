@@ -7,7 +7,6 @@
 
 #include <unordered_map>
 #include <regex>
-#include <cstring>
 
 namespace {
 
@@ -95,10 +94,6 @@ tristan::network::Url::Url(const std::string& p_url) :
             m_host = std::move(authority);
             netDebug("m_host = " + m_host);
             Url::_resolveHost();
-            if (m_error) {
-                netError(m_error.message());
-                return;
-            }
         } else {
             IP ip;
             ip.as_int = tristan::network::utility::stringIpToUint32_tIp(authority);
@@ -172,12 +167,8 @@ void tristan::network::Url::setAuthority(const std::string& p_host, const std::s
     }
     m_host = p_host;
     netDebug("m_host = " + m_host);
+    m_host_ip.clear();
     Url::_resolveHost();
-    if (m_error) {
-        netError(m_error.message());
-        m_valid = false;
-        return;
-    }
     m_user_name = p_user_name;
     netDebug("m_user_name" + m_user_name);
     size_t char_to_encode = 0;
@@ -206,6 +197,7 @@ void tristan::network::Url::setAuthority(const std::string& p_host, const std::s
 
 void tristan::network::Url::addHostIP(const std::string& p_ip) {
     netDebug("Adding host ip " + p_ip);
+    Url::_takeResolvedHost();
     std::regex regex(g_ip_regex_pattern);
     std::smatch ip_check_result;
     std::regex_match(p_ip, ip_check_result, regex);
@@ -292,14 +284,32 @@ auto tristan::network::Url::userPassword() const noexcept -> const std::string&
 
 auto tristan::network::Url::host() const noexcept -> const std::string& { return m_host; }
 
+auto tristan::network::Url::hostResolved() const -> bool {
+    return not m_resolved_host.valid() || m_resolved_host.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+auto tristan::network::Url::notifyWhenHostResolved(std::function< void() > p_callback) const -> bool {
+    return tristan::network::Resolver::notifyWhenResolved(m_host, m_resolved_host, std::move(p_callback));
+}
+
 auto tristan::network::Url::hostIP() const noexcept -> IP {
-    if (not m_host_ip.empty()) {
-        return m_host_ip.at(0);
+    const auto& host_ip = Url::hostIPList();
+    if (not host_ip.empty()) {
+        return host_ip.at(0);
     }
     return {};
 }
 
-auto tristan::network::Url::hostIPList() const noexcept -> const std::vector< IP >& { return m_host_ip; }
+auto tristan::network::Url::hostIPList() const noexcept -> const std::vector< IP >& {
+    if (m_resolved_host.valid()) {
+        try {
+            return m_resolved_host.get().addresses;
+        } catch (const std::future_error& p_error) {
+            netError(p_error.what());
+        }
+    }
+    return m_host_ip;
+}
 
 auto tristan::network::Url::port() const noexcept -> const std::string& { return m_port; }
 
@@ -353,51 +363,41 @@ auto tristan::network::Url::composeUrl() const -> std::string {
     return uri;
 }
 
-auto tristan::network::Url::isValid() const noexcept -> bool { return m_valid; }
+auto tristan::network::Url::isValid() const noexcept -> bool { return m_valid && not Url::_resolutionError(); }
 
-auto tristan::network::Url::error() const noexcept -> std::error_code { return m_error; }
+auto tristan::network::Url::error() const noexcept -> std::error_code {
+    if (m_error) {
+        return m_error;
+    }
+    return Url::_resolutionError();
+}
 
 void tristan::network::Url::_resolveHost() {
-    netInfo("Resolving host " + m_host);
-    auto* resolver_results = gethostbyname(m_host.c_str());
-    if (resolver_results == nullptr) {
-        switch (h_errno) {
-            case HOST_NOT_FOUND: {
-                m_error = tristan::network::makeError(tristan::network::UrlErrors::NOT_FOUND_ERROR);
-                break;
-            }
-            case TRY_AGAIN: {
-                m_error = tristan::network::makeError(tristan::network::UrlErrors::TRY_AGAIN_ERROR);
-                break;
-            }
-            case NO_RECOVERY: {
-                m_error = tristan::network::makeError(tristan::network::UrlErrors::NO_RECOVERY_ERROR);
-                break;
-            }
-            case NO_DATA: {
-                m_error = tristan::network::makeError(tristan::network::UrlErrors::NO_DATA_ERROR);
-                break;
-            }
-        }
+    //Request construction should not wait for DNS, the result is awaited only when the address is needed.
+    m_resolved_host = tristan::network::Resolver::resolveAsync(m_host);
+}
+
+void tristan::network::Url::_takeResolvedHost() {
+    if (not m_resolved_host.valid()) {
         return;
     }
-    uint8_t index = 0;
-    while (true) {
-        auto* address = resolver_results->h_addr_list[index];
-        if (address == nullptr) {
-            break;
-        }
-        IP ip;
-        std::memmove(&ip.as_int, address, 4);
-        auto string_ip = tristan::network::utility::uint32_tIpToStringIp(ip.as_int);
-        if (not string_ip.empty()) {
-            ip.as_string = std::move(string_ip);
-            netInfo("Host was resolved to " + ip.as_string);
-            m_host_ip.emplace_back(std::move(ip));
-        } else {
-            m_error = tristan::network::makeError(tristan::network::UrlErrors::IP_CONVERTER_ERROR);
-            return;
-        }
-        ++index;
+    const auto& resolved_host = m_resolved_host.get();
+    if (resolved_host.error) {
+        m_error = resolved_host.error;
+        m_valid = false;
+    }
+    m_host_ip.insert(m_host_ip.end(), resolved_host.addresses.begin(), resolved_host.addresses.end());
+    m_resolved_host = {};
+}
+
+auto tristan::network::Url::_resolutionError() const noexcept -> std::error_code {
+    if (not m_resolved_host.valid() || not Url::hostResolved()) {
+        return {};
+    }
+    try {
+        return m_resolved_host.get().error;
+    } catch (const std::future_error& p_error) {
+        netError(p_error.what());
+        return tristan::network::makeError(tristan::network::UrlErrors::NO_RECOVERY_ERROR);
     }
 }